@@ -9,6 +9,7 @@
 #ifndef DSPERADOS_MATH_ACCESS_HPP
 #define DSPERADOS_MATH_ACCESS_HPP
 
+#include <algorithm>
 #include <iterator>
 #include <stdexcept>
 
@@ -73,6 +74,93 @@ namespace math
         }
     };
     
+    //! Function object for clamped range access without branches
+    /*! Clamps the index with min/max directly, instead of going through clamp() and its
+        argument checking, so the compiler can emit conditional moves in hot loops
+     @warning If begin == end, the result is undefined */
+    struct FastClampedAccess
+    {
+        template <class InputIterator>
+        constexpr auto operator()(InputIterator begin, InputIterator end, std::ptrdiff_t index) const
+        {
+            return *std::next(begin, std::max<std::ptrdiff_t>(0, std::min(index, std::distance(begin, end) - 1)));
+        }
+    };
+
+    //! Function object for wrapped range access without branches
+    /*! Folds the index with a double modulo instead of the looping in wrap(), so far-out
+        indices cost the same as nearby ones and the loop branches disappear
+     @warning If begin == end, the result is undefined */
+    struct FastWrappedAccess
+    {
+        template <class InputIterator>
+        constexpr auto operator()(InputIterator begin, InputIterator end, std::ptrdiff_t index) const
+        {
+            const auto size = std::distance(begin, end);
+            return *std::next(begin, ((index % size) + size) % size);
+        }
+    };
+
+    //! Function object for clamped range access with the size cached at construction
+    /*! Computing std::distance() per element is the remaining overhead of FastClampedAccess;
+        construct this once per range instead, so the hot loop only clamps and dereferences
+     @warning If the cached size doesn't match the range, the result is undefined */
+    struct CachedClampedAccess
+    {
+        CachedClampedAccess(std::size_t size) : last(static_cast<std::ptrdiff_t>(size) - 1) { }
+
+        template <class InputIterator>
+        constexpr auto operator()(InputIterator begin, InputIterator, std::ptrdiff_t index) const
+        {
+            return *std::next(begin, std::max<std::ptrdiff_t>(0, std::min(index, last)));
+        }
+
+        //! The highest valid index of the range
+        std::ptrdiff_t last = 0;
+    };
+
+    //! Function object for wrapped range access with the size cached at construction
+    /*! The size-cached counterpart of FastWrappedAccess: construct once per range, so the hot
+        loop only folds and dereferences. For power-of-two sizes, MaskedWrappedAccess is
+        cheaper still.
+     @warning If the cached size doesn't match the range, the result is undefined */
+    struct CachedWrappedAccess
+    {
+        CachedWrappedAccess(std::size_t size) : size(static_cast<std::ptrdiff_t>(size)) { }
+
+        template <class InputIterator>
+        constexpr auto operator()(InputIterator begin, InputIterator, std::ptrdiff_t index) const
+        {
+            return *std::next(begin, ((index % size) + size) % size);
+        }
+
+        //! The size of the range
+        std::ptrdiff_t size = 0;
+    };
+
+    //! Function object for wrapped range access over a power-of-two size
+    /*! Wraps with a single bitwise AND against a mask cached at construction — the cheapest
+        wrap there is, for wavetables sized with ceilToPowerOf2()
+     @throw std::invalid_argument if the size is not a power of two
+     @warning If the cached size doesn't match the range, the result is undefined */
+    struct MaskedWrappedAccess
+    {
+        MaskedWrappedAccess(std::size_t size) : mask(static_cast<std::ptrdiff_t>(size) - 1)
+        {
+            if (!isPowerOf2(size))
+                throw std::invalid_argument("size is not a power of two");
+        }
+
+        template <class InputIterator>
+        constexpr auto operator()(InputIterator begin, InputIterator, std::ptrdiff_t index) const
+        {
+            return *std::next(begin, index & mask);
+        }
+
+        //! The wrap mask, size - 1
+        std::ptrdiff_t mask = 0;
+    };
+
     //! Function object for mirrored range access
     /*! Mirrors index before accessing a range
      @warning If begin == end, the result is undefined */
@@ -90,6 +178,37 @@ namespace math
         }
     };
     
+    //! Function object for mirrored range access without the fold loop
+    /*! Folds the index in closed form — one modulo over the mirror period plus a reflection —
+        so far-out indices cost the same as nearby ones, instead of one loop iteration per
+        period like MirroredAccess
+     @warning If the range holds fewer than two elements, the result is undefined */
+    struct FastMirroredAccess
+    {
+        template <class InputIterator>
+        constexpr auto operator()(InputIterator begin, InputIterator end, std::ptrdiff_t index) const
+        {
+            const auto period = 2 * (std::distance(begin, end) - 1);
+            auto folded = ((index % period) + period) % period;
+            if (folded > period / 2)
+                folded = period - folded;
+
+            return *std::next(begin, folded);
+        }
+    };
+
+    //! Function object for direct range access without boundary handling
+    /*! Dereferences the index as-is, skipping the out-of-range checks of the other accessors
+     @warning If the index lies outside of the range, the result is undefined */
+    struct UncheckedAccess
+    {
+        template <class InputIterator>
+        constexpr auto operator()(InputIterator begin, InputIterator end, std::ptrdiff_t index) const
+        {
+            return *std::next(begin, index);
+        }
+    };
+
     //! Access element in a range, taking an accessor for out-of-range handling
     template <class InputIterator, class Accessor = ThrowAccess>
     auto access(InputIterator begin, InputIterator end, std::ptrdiff_t index, Accessor accessor = Accessor())
@@ -0,0 +1,109 @@
+//
+//  allocator.hpp
+//  Math
+//
+//  Copyright © 2015-2016 Dsperados (info@dsperados.com). All rights reserved.
+//  Licensed under the BSD 3-clause license.
+//
+
+#ifndef DSPERADOS_MATH_ALLOCATOR_HPP
+#define DSPERADOS_MATH_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace math
+{
+    //! Fixed-capacity memory arena
+    /*! Hands out memory by bumping a pointer into a caller-provided buffer. Individual
+        deallocation is a no-op; the whole arena is reclaimed at once with clear(). This keeps
+        the allocating APIs off the general-purpose heap on real-time threads.
+
+        @code{cpp}
+        char memory[16384];
+        Arena arena(memory, sizeof(memory));
+
+        auto buffer = generateSineBuffer<float>(512, ArenaAllocator<float>(arena));
+        @endcode */
+    class Arena
+    {
+    public:
+        //! Construct an arena on top of caller-provided memory
+        Arena(void* memory, std::size_t capacity) :
+            base(static_cast<char*>(memory)),
+            capacity(capacity)
+        {
+
+        }
+
+        //! Allocate a number of bytes with a given alignment
+        /*! @return nullptr if the arena has run out of memory */
+        void* allocate(std::size_t bytes, std::size_t alignment)
+        {
+            // Align the actual address, not the offset; the buffer itself may not be aligned
+            const auto address = reinterpret_cast<std::uintptr_t>(base) + offset;
+            const auto aligned = (address + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+            const auto alignedOffset = aligned - reinterpret_cast<std::uintptr_t>(base);
+
+            if (alignedOffset + bytes > capacity)
+                return nullptr;
+
+            offset = alignedOffset + bytes;
+            return base + alignedOffset;
+        }
+
+        //! Reclaim all allocations at once
+        void clear() { offset = 0; }
+
+        //! The number of bytes currently in use
+        std::size_t used() const { return offset; }
+
+    private:
+        //! The caller-provided memory
+        char* base = nullptr;
+
+        //! The size of the memory in bytes
+        std::size_t capacity = 0;
+
+        //! The current bump offset
+        std::size_t offset = 0;
+    };
+
+    //! Standard-compatible allocator drawing from an Arena
+    /*! Plugs arena allocation into std::vector and the buffer-returning APIs of this library
+     @throw std::bad_alloc when the arena runs out of memory */
+    template <typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        ArenaAllocator(Arena& arena) : arena(&arena) { }
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& rhs) : arena(rhs.arena) { }
+
+        T* allocate(std::size_t n)
+        {
+            auto memory = arena->allocate(n * sizeof(T), alignof(T));
+            if (!memory)
+                throw std::bad_alloc();
+
+            return static_cast<T*>(memory);
+        }
+
+        void deallocate(T*, std::size_t) { }
+
+        //! The arena the memory is drawn from
+        Arena* arena = nullptr;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) { return lhs.arena == rhs.arena; }
+
+    template <typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) { return !(lhs == rhs); }
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <utility>
 #include <vector>
 
 namespace math
@@ -32,66 +33,199 @@ namespace math
             return range.first;
     }
     
-    //! Find the local minima of a signal
+    //! Find the highest absolute value in a range
+    /*! Single-pass alternative to findExtrema() for when only the magnitude of the peak
+        matters, costing one comparison per element instead of the min/max bookkeeping */
     template <typename Iterator>
-    std::vector<size_t> findLocalMinimaPositions(Iterator begin, Iterator end)
+    auto findAbsolutePeak(Iterator begin, Iterator end)
     {
+        typename std::iterator_traits<Iterator>::value_type peak = 0;
+        for (auto it = begin; it != end; ++it)
+        {
+            const auto value = std::abs(*it);
+            if (value > peak)
+                peak = value;
+        }
+
+        return peak;
+    }
+
+    //! Find the local minima of a signal, reusing a caller-owned output vector
+    /*! The vector is cleared but keeps its capacity, so repeated scans don't reallocate. It may
+        use any allocator, e.g. an ArenaAllocator on real-time threads.
+        The first and last element never count as extrema; they miss a neighbour to compare to. */
+    template <typename Iterator, typename Allocator>
+    void findLocalMinimaPositions(Iterator begin, Iterator end, std::vector<size_t, Allocator>& minima)
+    {
+        minima.clear();
+
         // If we only received two points or less, there is no minimum
         const auto d = std::distance(begin, end);
         if (d < 3)
-            return {};
-        
+            return;
+
         // Store three iterators for the previous, current and next sample
         auto p = begin;
         auto c = std::next(p);
         auto n = std::next(c);
-        
+
         // Loop through the range, storing the position of each minimum
-        std::vector<size_t> minima;
-        for (size_t pos = 1; c != end; ++pos)
+        for (size_t pos = 1; n != end; ++pos)
         {
             // Is the previous sample bigger than the current, and the current smaller or equal than the next?
             if (*p > *c && *c <= *n)
                 minima.emplace_back(pos);
-            
+
             // Move the iterators forward
             p = c;
             c = n++;
         }
-        
-        return minima;
     }
-    
+
     //! Find the local minima of a signal
     template <typename Iterator>
-    std::vector<size_t> findLocalMaximaPositions(Iterator begin, Iterator end)
+    std::vector<size_t> findLocalMinimaPositions(Iterator begin, Iterator end)
     {
+        std::vector<size_t> minima;
+        findLocalMinimaPositions(begin, end, minima);
+
+        return minima;
+    }
+
+    //! Find the local maxima of a signal, reusing a caller-owned output vector
+    /*! The vector is cleared but keeps its capacity, so repeated scans don't reallocate. It may
+        use any allocator, e.g. an ArenaAllocator on real-time threads.
+        The first and last element never count as extrema; they miss a neighbour to compare to. */
+    template <typename Iterator, typename Allocator>
+    void findLocalMaximaPositions(Iterator begin, Iterator end, std::vector<size_t, Allocator>& maxima)
+    {
+        maxima.clear();
+
         // If we only received two points or less, there is no maximum
         const auto d = std::distance(begin, end);
         if (d < 3)
-            return {};
-        
+            return;
+
         // Store three iterators for the previous, current and next sample
         auto p = begin;
         auto c = std::next(p);
         auto n = std::next(c);
-        
+
         // Loop through the range, storing the position of each maximum
-        std::vector<size_t> maxima;
-        for (size_t pos = 1; c != end; ++pos)
+        for (size_t pos = 1; n != end; ++pos)
         {
             // Is the previous sample smaller than the current, and the current bigger or equal than the next?
             if (*p < *c && *c >= *n)
                 maxima.emplace_back(pos);
-            
+
             // Move the iterators forward
             p = c;
             c = n++;
         }
-        
+    }
+
+    //! Find the local maxima of a signal
+    template <typename Iterator>
+    std::vector<size_t> findLocalMaximaPositions(Iterator begin, Iterator end)
+    {
+        std::vector<size_t> maxima;
+        findLocalMaximaPositions(begin, end, maxima);
+
         return maxima;
     }
+
+    //! Find the local minima of a signal, with their values
+    /*! Returns (position, value) pairs, saving the caller a second pass to look the values up.
+        The output vector is cleared but keeps its capacity. */
+    template <typename Iterator, typename Allocator>
+    void findLocalMinima(Iterator begin, Iterator end, std::vector<std::pair<size_t, typename std::iterator_traits<Iterator>::value_type>, Allocator>& minima)
+    {
+        minima.clear();
+
+        const auto d = std::distance(begin, end);
+        if (d < 3)
+            return;
+
+        auto p = begin;
+        auto c = std::next(p);
+        auto n = std::next(c);
+
+        for (size_t pos = 1; n != end; ++pos)
+        {
+            if (*p > *c && *c <= *n)
+                minima.emplace_back(pos, *c);
+
+            p = c;
+            c = n++;
+        }
+    }
+
+    //! Find the local maxima of a signal, with their values
+    /*! Returns (position, value) pairs, saving the caller a second pass to look the values up.
+        The output vector is cleared but keeps its capacity. */
+    template <typename Iterator, typename Allocator>
+    void findLocalMaxima(Iterator begin, Iterator end, std::vector<std::pair<size_t, typename std::iterator_traits<Iterator>::value_type>, Allocator>& maxima)
+    {
+        maxima.clear();
+
+        const auto d = std::distance(begin, end);
+        if (d < 3)
+            return;
+
+        auto p = begin;
+        auto c = std::next(p);
+        auto n = std::next(c);
+
+        for (size_t pos = 1; n != end; ++pos)
+        {
+            if (*p < *c && *c >= *n)
+                maxima.emplace_back(pos, *c);
+
+            p = c;
+            c = n++;
+        }
+    }
     
+    //! Find the local minima and maxima of a signal in one sweep
+    /*! Envelope extraction needs both kinds of extrema; this scans the range once for the two
+        instead of twice. The vectors are cleared but keep their capacity. */
+    template <typename Iterator, typename MinimaAllocator, typename MaximaAllocator>
+    void findLocalExtremaPositions(Iterator begin, Iterator end, std::vector<size_t, MinimaAllocator>& minima, std::vector<size_t, MaximaAllocator>& maxima)
+    {
+        minima.clear();
+        maxima.clear();
+
+        const auto d = std::distance(begin, end);
+        if (d < 3)
+            return;
+
+        auto p = begin;
+        auto c = std::next(p);
+        auto n = std::next(c);
+
+        for (size_t pos = 1; n != end; ++pos)
+        {
+            if (*p > *c && *c <= *n)
+                minima.emplace_back(pos);
+            else if (*p < *c && *c >= *n)
+                maxima.emplace_back(pos);
+
+            p = c;
+            c = n++;
+        }
+    }
+
+    //! Find the local minima and maxima of a signal in one sweep
+    /*! @return The minima and maxima positions, in that order */
+    template <typename Iterator>
+    std::pair<std::vector<size_t>, std::vector<size_t>> findLocalExtremaPositions(Iterator begin, Iterator end)
+    {
+        std::pair<std::vector<size_t>, std::vector<size_t>> extrema;
+        findLocalExtremaPositions(begin, end, extrema.first, extrema.second);
+
+        return extrema;
+    }
+
     //! Count the number of zero crossings in a container
     template <typename Iterator>
     size_t countZeroCrossings(Iterator begin, Iterator end)
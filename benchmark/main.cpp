@@ -0,0 +1,181 @@
+//
+//  main.cpp
+//  Math benchmark
+//
+//  Copyright © 2015-2016 Dsperados (info@dsperados.com). All rights reserved.
+//  Licensed under the BSD 3-clause license.
+//
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../analysis.hpp"
+#include "../interpolation.hpp"
+#include "../linear.hpp"
+#include "../normalize.hpp"
+#include "../sinusoid.hpp"
+#include "../spline.hpp"
+#include "../statistics.hpp"
+
+using namespace math;
+using namespace std;
+
+namespace
+{
+    //! Run a function repeatedly and print throughput statistics
+    /*! Reports the time per element and the streamed bandwidth, plus the relative standard
+        deviation over several passes so a noisy run is visible in the numbers themselves
+     @param elements The number of elements one call processes
+     @param bytes The number of bytes one call streams (reads plus writes) */
+    template <typename Function>
+    void measure(const string& name, size_t iterations, size_t elements, size_t bytes, Function function)
+    {
+        constexpr size_t passes = 5;
+
+        // Warm up the caches before taking the time
+        function();
+
+        array<double, passes> nanosecondsPerCall;
+        for (auto& time : nanosecondsPerCall)
+        {
+            const auto start = chrono::high_resolution_clock::now();
+            for (size_t i = 0; i < iterations; ++i)
+                function();
+            const auto stop = chrono::high_resolution_clock::now();
+
+            time = chrono::duration_cast<chrono::nanoseconds>(stop - start).count() / static_cast<double>(iterations);
+        }
+
+        double mean = 0;
+        for (auto& time : nanosecondsPerCall)
+            mean += time;
+        mean /= passes;
+
+        double variance = 0;
+        for (auto& time : nanosecondsPerCall)
+            variance += (time - mean) * (time - mean);
+        const auto deviation = sqrt(variance / passes);
+
+        // bytes per nanosecond happens to equal gigabytes per second
+        cout << name << ": " << mean / elements << " ns/element, "
+             << bytes / mean << " GB/s, +-" << 100 * deviation / mean << "%" << endl;
+    }
+}
+
+int main()
+{
+    constexpr size_t frameSize = 4096;
+
+    mt19937 engine(0);
+    vector<float> frame(frameSize);
+    for (auto& sample : frame)
+        sample = uniform_real_distribution<float>(-1, 1)(engine);
+
+    // dot product, from cache-resident to L2-straining sizes, plus a strided sweep
+    for (size_t size : {size_t{64}, size_t{1024}, size_t{16384}})
+    {
+        vector<float> a(size), b(size);
+        for (size_t i = 0; i < size; ++i)
+            a[i] = b[i] = frame[i % frameSize];
+
+        measure("dot (contiguous float, " + to_string(size) + ")", 10000, size, 2 * size * sizeof(float), [&]{
+            volatile auto result = dot(a.data(), b.data(), size);
+            (void)result;
+        });
+    }
+
+    measure("dot (stride 2, 2048)", 10000, frameSize / 2, frameSize * sizeof(float), [&]{
+        volatile auto result = dot(frame.data(), 2, frame.data() + 1, 2, frameSize / 2);
+        (void)result;
+    });
+
+    // batch interpolation, resampling the frame at a fractional ratio
+    vector<double> indices(frameSize);
+    for (size_t i = 0; i < frameSize; ++i)
+        indices[i] = i * 0.9371;
+    vector<float> out(frameSize);
+
+    const auto interpolationBytes = frameSize * (sizeof(double) + 2 * sizeof(float));
+
+    measure("interpolate (batch, linear)", 1000, frameSize, interpolationBytes, [&]{
+        interpolate(frame.begin(), frame.end(), indices.begin(), indices.end(), out.begin());
+    });
+
+    measure("interpolate (batch, Catmull-Rom)", 1000, frameSize, interpolationBytes, [&]{
+        interpolate(frame.begin(), frame.end(), indices.begin(), indices.end(), out.begin(), CatmullRomInterpolation());
+    });
+
+    measure("interpolate (batch, Catmull-Rom, wrapped)", 1000, frameSize, interpolationBytes, [&]{
+        interpolate(frame.begin(), frame.end(), indices.begin(), indices.end(), out.begin(), CatmullRomInterpolation(), WrappedAccess());
+    });
+
+    // spline solve as a function of the point count, and the sweep over a whole buffer
+    for (size_t points : {size_t{64}, size_t{512}, size_t{4096}})
+    {
+        CubicSpline spline;
+        spline.deferRecomputation();
+        for (size_t i = 0; i < points; ++i)
+            spline.emplace(static_cast<float>(i), frame[i % frameSize]);
+        spline.deferRecomputation(false);
+
+        float toggle = 0;
+        measure("CubicSpline recompute (" + to_string(points) + " points)", 100, points, points * 9 * sizeof(float), [&]{
+            toggle = 1 - toggle;
+            spline.setY(0.f, toggle, points);
+        });
+    }
+
+    CubicSpline spline;
+    for (auto i = 0; i < 200; ++i)
+        spline.emplace(i * frameSize / 200.f, frame[i]);
+
+    measure("CubicSpline::span", 100, frameSize, frameSize * sizeof(float), [&]{
+        volatile auto result = spline.span(0, frameSize).size();
+        (void)result;
+    });
+
+    // analysis scans
+    vector<size_t> positions;
+    measure("findLocalMinimaPositions", 1000, frameSize, frameSize * sizeof(float), [&]{
+        findLocalMinimaPositions(frame.begin(), frame.end(), positions);
+    });
+
+    measure("countZeroCrossings", 1000, frameSize, frameSize * sizeof(float), [&]{
+        volatile auto result = countZeroCrossings(frame.begin(), frame.end());
+        (void)result;
+    });
+
+    measure("findAbsolutePeak", 1000, frameSize, frameSize * sizeof(float), [&]{
+        volatile auto result = findAbsolutePeak(frame.begin(), frame.end());
+        (void)result;
+    });
+
+    // per-frame statistics
+    measure("summarize", 10000, frameSize, frameSize * sizeof(float), [&]{
+        volatile auto result = summarize<float>(frame.begin(), frame.end()).rootMeanSquare;
+        (void)result;
+    });
+
+    // sinusoid generation
+    measure("generateSine", 1000, frameSize, frameSize * sizeof(float), [&]{
+        generateSine(out.begin(), out.end());
+    });
+
+    SinusoidGenerator<float> generator(TAU<double> * 440 / 44100);
+    measure("SinusoidGenerator::generate", 1000, frameSize, frameSize * sizeof(float), [&]{
+        generator.generate(out.begin(), out.end());
+    });
+
+    // normalization
+    measure("normalize", 1000, frameSize, 2 * frameSize * sizeof(float), [&]{
+        normalize(frame.begin(), frame.end(), out.begin());
+    });
+
+    return 0;
+}
@@ -28,4 +28,36 @@ namespace math
         
         return atan2(dx, dy);
     }
+
+	void quadraticBezierAngles(double* outBegin, std::size_t count, const Point2f& control1, const Point2f& control2, const Point2f& point)
+    {
+        if (count == 0)
+            return;
+
+        const auto step = count > 1 ? 1.0 / (count - 1) : 0.0;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto t = i * step;
+            const auto invt = 1 - t;
+
+            // Same basis as quadraticBezierAngle(), with the zero first-point terms dropped
+            const auto c2 = 3 * invt * invt * -6 * t * invt;
+            const auto c3 = -3 * t * t + 6 * t * invt;
+            const auto c4 = 3 * t * t;
+
+            const auto dx = (c2 * control1.x) + (c3 * control2.x) + (c4 * point.x);
+            const auto dy = (c2 * control1.y) + (c3 * control2.y) + (c4 * point.y);
+
+            outBegin[i] = atan2(dx, dy);
+        }
+    }
+
+	std::vector<double> quadraticBezierAngles(std::size_t count, const Point2f& control1, const Point2f& control2, const Point2f& point)
+    {
+        std::vector<double> angles(count);
+        quadraticBezierAngles(angles.data(), count, control1, control2, point);
+
+        return angles;
+    }
 }
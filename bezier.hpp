@@ -9,12 +9,24 @@
 #ifndef DSPERADOS_MATH_BEZIER_HPP
 #define DSPERADOS_MATH_BEZIER_HPP
 
+#include <cstddef>
+#include <vector>
+
 #include <dsperados/geometry/point.hpp>
 
 namespace math
 {
 	//! The angle at any point of a quadratic bezier curve
 	double quadraticBezierAngle(const double t, const geo::Point2f& control1, const geo::Point2f& control2, const geo::Point2f& point);
+
+	//! The angles at evenly spaced points of a quadratic bezier curve, in caller-owned storage
+	/*! Writes count angles for t = 0 up to 1 to outBegin. The basis is still derived per point,
+	 but the per-call overhead of quadraticBezierAngle() is hoisted out of the loop and the
+	 always-zero first-point terms are dropped */
+	void quadraticBezierAngles(double* outBegin, std::size_t count, const geo::Point2f& control1, const geo::Point2f& control2, const geo::Point2f& point);
+
+	//! The angles at evenly spaced points of a quadratic bezier curve
+	std::vector<double> quadraticBezierAngles(std::size_t count, const geo::Point2f& control1, const geo::Point2f& control2, const geo::Point2f& point);
 }
 
 #endif
@@ -0,0 +1,175 @@
+//
+//  fastmath.hpp
+//  Math
+//
+//  Copyright © 2015-2016 Dsperados (info@dsperados.com). All rights reserved.
+//  Licensed under the BSD 3-clause license.
+//
+
+#ifndef DSPERADOS_MATH_FASTMATH_HPP
+#define DSPERADOS_MATH_FASTMATH_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "constants.hpp"
+
+namespace math
+{
+    //! Approximate transcendental functions
+    /*! Polynomial approximations of the libm functions used in the per-sample paths of this
+        library (sigmoids, sinusoids, bezier angles). Within the representable range they stay
+        within ~1e-6 relative error, which is well below audibility for audio-rate use, while
+        running several times faster than their full-precision counterparts and inlining into
+        surrounding loops. At the edges of that range they saturate like their libm
+        counterparts: fast::exp() underflows to 0 and overflows to infinity. */
+    namespace fast
+    {
+        //! Approximate the sine of an angle
+        /*! Taylor expansion after folding the angle into [-π, π], accurate to ~1e-7 */
+        template <typename T>
+        T sin(T x)
+        {
+            // Fold the angle into [-π, π]
+            x -= static_cast<long long>(x / TAU<T>) * TAU<T>;
+            if (x > PI<T>)
+                x -= TAU<T>;
+            else if (x < -PI<T>)
+                x += TAU<T>;
+
+            // Evaluate the Taylor series with Horner's scheme
+            const auto x2 = x * x;
+            T result = 1;
+            result = 1 - x2 / (16 * 17) * result;
+            result = 1 - x2 / (14 * 15) * result;
+            result = 1 - x2 / (12 * 13) * result;
+            result = 1 - x2 / (10 * 11) * result;
+            result = 1 - x2 / (8 * 9) * result;
+            result = 1 - x2 / (6 * 7) * result;
+            result = 1 - x2 / (4 * 5) * result;
+            result = 1 - x2 / (2 * 3) * result;
+
+            return x * result;
+        }
+
+        //! Approximate the cosine of an angle
+        template <typename T>
+        T cos(T x)
+        {
+            return fast::sin(x + HALF_PI<T>);
+        }
+
+        //! Approximate the natural exponential
+        /*! Splits x into an integer power of two and a fraction; the fraction is expanded as a
+            Taylor series and the power of two is applied by writing the exponent bits directly.
+            Arguments outside roughly [-708, 709] saturate to 0 and infinity, like std::exp */
+        template <typename T>
+        T exp(T x)
+        {
+            const double y = static_cast<double>(x) * 1.4426950408889634; // x / ln(2)
+            const double n = std::floor(y);
+
+            // The exponent bits only encode 2^n for n in [-1022, 1023]; anything beyond would
+            // wrap into the sign and mantissa bits, so saturate the way std::exp does
+            if (n < -1022)
+                return 0;
+            if (n > 1023)
+                return std::numeric_limits<T>::infinity();
+            const double t = (y - n) * 0.6931471805599453; // fractional part, back in natural units
+
+            // exp(t) for t in [0, ln(2)) with Horner's scheme
+            double result = 1;
+            result = 1 + t / 9 * result;
+            result = 1 + t / 8 * result;
+            result = 1 + t / 7 * result;
+            result = 1 + t / 6 * result;
+            result = 1 + t / 5 * result;
+            result = 1 + t / 4 * result;
+            result = 1 + t / 3 * result;
+            result = 1 + t / 2 * result;
+            result = 1 + t * result;
+
+            // Construct 2^n by placing n in the exponent bits of a double
+            const auto bits = static_cast<std::uint64_t>(static_cast<long long>(n) + 1023) << 52;
+            double scale = 0;
+            std::memcpy(&scale, &bits, sizeof(scale));
+
+            return result * scale;
+        }
+
+        //! Approximate the inverse tangent
+        /*! Reduces the argument below tan(π/8) with the identities atan(x) = π/2 - atan(1/x)
+            and atan(x) = π/4 + atan((x - 1) / (x + 1)), then expands as a Taylor series */
+        template <typename T>
+        T atan(T x)
+        {
+            const T absolute = x < 0 ? -x : x;
+
+            // Reduce to [0, 1], then to [-tan(π/8), tan(π/8)]
+            const bool invert = absolute > 1;
+            const T reduced = invert ? 1 / absolute : absolute;
+            const bool rotate = reduced > SQRT_TWO<T> - 1;
+            const T t = rotate ? (reduced - 1) / (reduced + 1) : reduced;
+
+            // Evaluate the Taylor series with Horner's scheme
+            const auto t2 = t * t;
+            T result = T(1) / 11;
+            result = T(1) / 9 - t2 * result;
+            result = T(1) / 7 - t2 * result;
+            result = T(1) / 5 - t2 * result;
+            result = T(1) / 3 - t2 * result;
+            result = 1 - t2 * result;
+            result *= t;
+
+            // Undo the reductions
+            if (rotate)
+                result += QUARTER_PI<T>;
+            if (invert)
+                result = HALF_PI<T> - result;
+
+            return x < 0 ? -result : result;
+        }
+
+        //! Approximate the inverse tangent of y / x, respecting the quadrant
+        template <typename T>
+        T atan2(T y, T x)
+        {
+            if (x > 0)
+                return fast::atan(y / x);
+            else if (x < 0)
+                return fast::atan(y / x) + (y < 0 ? -PI<T> : PI<T>);
+            else
+                return y > 0 ? HALF_PI<T> : y < 0 ? -HALF_PI<T> : 0;
+        }
+
+        //! Approximate the hyperbolic tangent
+        template <typename T>
+        T tanh(T x)
+        {
+            // The approximation saturates within 1e-8 beyond |x| = 9
+            if (x > 9)
+                return 1;
+            else if (x < -9)
+                return -1;
+
+            const T e = fast::exp(2 * x);
+            return (e - 1) / (e + 1);
+        }
+
+        //! Transcendental policy calling the approximations in this header
+        /*! Pass as the second template argument of SigmoidTan or SigmoidExp to trade a little
+            precision for per-sample speed */
+        struct Transcendentals
+        {
+            template <typename T>
+            static T atan(T x) { return fast::atan(x); }
+
+            template <typename T>
+            static T exp(T x) { return fast::exp(x); }
+        };
+    }
+}
+
+#endif
@@ -9,6 +9,7 @@
 #ifndef DSPERADOS_MATH_INTERLEAVE_HPP
 #define DSPERADOS_MATH_INTERLEAVE_HPP
 
+#include <array>
 #include <cmath>
 #include <complex>
 #include <cstddef>
@@ -38,6 +39,51 @@ namespace math
             *outBegin2++ = *it;
         }
     }
+
+    //! Interleave any number of channels into a single range
+    /*! @param channels Iterators to the beginning of each channel
+     @param frames The number of frames (samples per channel) to interleave */
+    template <class ChannelIt, class OutputIt>
+    void interleave(const std::vector<ChannelIt>& channels, std::size_t frames, OutputIt outBegin)
+    {
+        auto heads = channels;
+        for (std::size_t frame = 0; frame != frames; ++frame)
+            for (auto& head : heads)
+                *outBegin++ = *head++;
+    }
+
+    //! Deinterleave a range into any number of channels
+    /*! @param channels Iterators to the beginning of each channel */
+    template <class InputIt, class ChannelIt>
+    void deinterleave(InputIt inBegin, InputIt inEnd, const std::vector<ChannelIt>& channels)
+    {
+        auto heads = channels;
+        while (inBegin != inEnd)
+            for (auto& head : heads)
+                *head++ = *inBegin++;
+    }
+
+    //! Interleave a compile-time number of contiguous channels
+    /*! With the channel count and element type fixed at compile time the inner loop fully
+        unrolls, letting the compiler emit shuffle-based SIMD on the device I/O path */
+    template <class T, std::size_t N>
+    void interleave(const std::array<const T*, N>& channels, std::size_t frames, T* outBegin)
+    {
+        for (std::size_t frame = 0; frame != frames; ++frame)
+            for (std::size_t channel = 0; channel != N; ++channel)
+                outBegin[frame * N + channel] = channels[channel][frame];
+    }
+
+    //! Deinterleave into a compile-time number of contiguous channels
+    /*! With the channel count and element type fixed at compile time the inner loop fully
+        unrolls, letting the compiler emit shuffle-based SIMD on the device I/O path */
+    template <class T, std::size_t N>
+    void deinterleave(const T* inBegin, std::size_t frames, const std::array<T*, N>& channels)
+    {
+        for (std::size_t frame = 0; frame != frames; ++frame)
+            for (std::size_t channel = 0; channel != N; ++channel)
+                channels[channel][frame] = inBegin[frame * N + channel];
+    }
 }
 
 #endif
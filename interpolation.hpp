@@ -9,7 +9,9 @@
 #ifndef DSPERADOS_MATH_INTERPOLATION_HPP
 #define DSPERADOS_MATH_INTERPOLATION_HPP
 
+#include <array>
 #include <cmath>
+#include <iterator>
 #include <stdexcept>
 #include <utility>
 
@@ -113,6 +115,13 @@ namespace math
 
             return interpolateNearest(fraction, x1, x2);
         }
+
+        //! Apply the kernel to already fetched taps
+        template <class T, class Index>
+        constexpr auto operator()(Index fraction, const std::array<T, 2>& taps)
+        {
+            return interpolateNearest(fraction, taps[0], taps[1]);
+        }
     };
 
     //! Function object for linear interpolation
@@ -131,6 +140,13 @@ namespace math
 
             return interpolateLinear(fraction, x1, x2);
         }
+
+        //! Apply the kernel to already fetched taps
+        template <class T, class Index>
+        constexpr auto operator()(Index fraction, const std::array<T, 2>& taps)
+        {
+            return interpolateLinear(fraction, taps[0], taps[1]);
+        }
     };
 
     //! Function object for cosine interpolation
@@ -149,6 +165,13 @@ namespace math
 
             return interpolateCosine(fraction, x1, x2);
         }
+
+        //! Apply the kernel to already fetched taps
+        template <class T, class Index>
+        constexpr auto operator()(Index fraction, const std::array<T, 2>& taps)
+        {
+            return interpolateCosine(fraction, taps[0], taps[1]);
+        }
     };
 
     //! Function object for cubic interpolation
@@ -169,6 +192,13 @@ namespace math
 
             return interpolateCubic(fraction, x1, x2, x3, x4);
         }
+
+        //! Apply the kernel to already fetched taps
+        template <class T, class Index>
+        constexpr auto operator()(Index fraction, const std::array<T, 4>& taps)
+        {
+            return interpolateCubic(fraction, taps[0], taps[1], taps[2], taps[3]);
+        }
     };
 
     //! Function object for Catmull-Rom interpolation
@@ -189,6 +219,13 @@ namespace math
 
             return interpolateCatmullRom(fraction, x1, x2, x3, x4);
         }
+
+        //! Apply the kernel to already fetched taps
+        template <class T, class Index>
+        constexpr auto operator()(Index fraction, const std::array<T, 4>& taps)
+        {
+            return interpolateCatmullRom(fraction, taps[0], taps[1], taps[2], taps[3]);
+        }
     };
 
     //! Function object for hermite interpolation
@@ -212,6 +249,13 @@ namespace math
             return interpolateHermite(fraction, x1, x2, x3, x4, tension, bias);
         }
 
+        //! Apply the kernel to already fetched taps
+        template <class T, class Index>
+        constexpr auto operator()(Index fraction, const std::array<T, 4>& taps)
+        {
+            return interpolateHermite(fraction, taps[0], taps[1], taps[2], taps[3], tension, bias);
+        }
+
         double tension = 0;
         double bias = 0;
     };
@@ -224,6 +268,134 @@ namespace math
     }
 
 
+    //! Access a range of interpolated samples, one for each index in [indexBegin, indexEnd)
+    /*! Batch version of interpolate(). The size of the input range is computed once, and as long
+        as an index only touches samples inside the range, the accessor (and its boundary checks)
+        is bypassed altogether. Only the stencils overlapping the edges go through the accessor.
+     @return The output iterator, one past the last written sample */
+    template <class InputIterator, class IndexIterator, class OutputIterator, class Interpolator = LinearInterpolation, class Accessor = ClampedAccess>
+    OutputIterator interpolate(InputIterator begin, InputIterator end, IndexIterator indexBegin, IndexIterator indexEnd, OutputIterator outBegin, Interpolator interpolator = Interpolator(), Accessor accessor = Accessor())
+    {
+        const std::ptrdiff_t size = std::distance(begin, end);
+
+        // The number of samples the interpolator touches before and after the truncated index
+        constexpr std::ptrdiff_t before = Interpolator::size / 2 - 1;
+        constexpr std::ptrdiff_t after = Interpolator::size - before - 1;
+
+        for (auto it = indexBegin; it != indexEnd; ++it)
+        {
+            const std::ptrdiff_t trunc = std::floor(*it);
+
+            // Stencils fully inside the range take the fast path without boundary handling
+            if (trunc >= before && trunc + after < size)
+                *outBegin++ = interpolator(begin, end, *it, UncheckedAccess());
+            else
+                *outBegin++ = interpolator(begin, end, *it, accessor);
+        }
+
+        return outBegin;
+    }
+
+    //! Interpolator for monotonic index sweeps, keeping the taps in a shift register
+    /*! Consecutive indices in a sweep share all but one of their taps, yet the interpolator
+        function objects refetch the full stencil on every call. This class binds the range
+        once and carries the taps from one call to the next: advancing the truncated index by
+        one shifts the register and fetches a single new sample, so a sweep touches every
+        input sample once instead of Interpolator::size times. Indices may repeat or jump;
+        only forward steps of one reuse the register, anything else refills it.
+
+        @code{cpp}
+        SlidingInterpolator<const float*, CatmullRomInterpolation> interpolator(table.data(), table.data() + table.size());
+
+        for (auto& index : indices)
+            *out++ = interpolator(index);
+        @endcode */
+    template <class InputIterator, class Interpolator = LinearInterpolation, class Accessor = ClampedAccess>
+    class SlidingInterpolator
+    {
+    public:
+        //! Bind the input range, computing its size once
+        SlidingInterpolator(InputIterator begin, InputIterator end, Interpolator interpolator = Interpolator(), Accessor accessor = Accessor()) :
+            begin(begin),
+            end(end),
+            size(std::distance(begin, end)),
+            interpolator(interpolator),
+            accessor(accessor)
+        {
+
+        }
+
+        //! Access an interpolated sample, reusing the taps of the previous call where possible
+        template <class Index>
+        auto operator()(Index index)
+        {
+            const std::ptrdiff_t trunc = std::floor(index);
+            const auto fraction = index - trunc;
+
+            if (!primed || trunc < cachedTrunc || trunc > cachedTrunc + static_cast<std::ptrdiff_t>(Interpolator::size))
+            {
+                // First call, or a jump: refill the whole register
+                for (std::size_t i = 0; i < Interpolator::size; ++i)
+                    taps[i] = fetch(trunc - before + static_cast<std::ptrdiff_t>(i));
+
+                cachedTrunc = trunc;
+                primed = true;
+            }
+            else
+            {
+                // Shift the register forward, fetching only the new samples
+                while (cachedTrunc < trunc)
+                {
+                    ++cachedTrunc;
+                    for (std::size_t i = 1; i < Interpolator::size; ++i)
+                        taps[i - 1] = taps[i];
+
+                    taps[Interpolator::size - 1] = fetch(cachedTrunc - before + static_cast<std::ptrdiff_t>(Interpolator::size) - 1);
+                }
+            }
+
+            return interpolator(fraction, taps);
+        }
+
+        //! Forget the cached taps, e.g. after the underlying data changed
+        void reset()
+        {
+            primed = false;
+        }
+
+    private:
+        //! Fetch a single tap, bypassing the accessor for indices inside the range
+        auto fetch(std::ptrdiff_t index)
+        {
+            if (index >= 0 && index < size)
+                return access(begin, end, index, UncheckedAccess());
+
+            return access(begin, end, index, accessor);
+        }
+
+    private:
+        //! The number of samples the interpolator touches before the truncated index
+        static constexpr std::ptrdiff_t before = Interpolator::size / 2 - 1;
+
+        //! The bound input range and its size
+        InputIterator begin;
+        InputIterator end;
+        std::ptrdiff_t size = 0;
+
+        //! The interpolation kernel and the accessor for out-of-range taps
+        Interpolator interpolator;
+        Accessor accessor;
+
+        //! The shift register holding the taps around cachedTrunc
+        std::array<typename std::iterator_traits<InputIterator>::value_type, Interpolator::size> taps;
+
+        //! The truncated index the register is centered on
+        std::ptrdiff_t cachedTrunc = 0;
+
+        //! Has the register been filled yet?
+        bool primed = false;
+    };
+
     //! Scale a number from one range to another
     /*! @throw std::invalid_argument if max1 <= min1 */
     template <class T1, class T2, class T3, class T4, class T5>
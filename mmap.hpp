@@ -0,0 +1,154 @@
+//
+//  mmap.hpp
+//  Math
+//
+//  Copyright © 2015-2016 Dsperados (info@dsperados.com). All rights reserved.
+//  Licensed under the BSD 3-clause license.
+//
+
+#ifndef DSPERADOS_MATH_MMAP_HPP
+#define DSPERADOS_MATH_MMAP_HPP
+
+// Memory mapping is inherently platform-specific; this header supports the POSIX systems and
+// leaves the rest of the library untouched, so only translation units that map files need it
+#if __has_include(<sys/mman.h>)
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace math
+{
+    //! A read-only file, memory-mapped as a contiguous range of samples
+    /*! Maps the whole file into virtual memory, so the iterator-based algorithms in this
+        library (analysis, statistics, normalization) can run over files far bigger than RAM:
+        the kernel pages data in as the sweep reaches it and drops it behind, keeping the
+        resident set constant. Because the mapping is contiguous there are no chunk seams to
+        handle — extrema and zero crossings across what would be chunk boundaries just work.
+
+        @code{cpp}
+        MemoryMappedFile<float> file("session.raw");
+
+        auto crossings = countZeroCrossings(file.begin(), file.end());
+        @endcode */
+    template <typename T>
+    class MemoryMappedFile
+    {
+    public:
+        //! Map a file, hinting the kernel the access will be sequential
+        /*! @throw std::runtime_error if the file can't be opened or mapped */
+        MemoryMappedFile(const std::string& path)
+        {
+            const auto descriptor = ::open(path.c_str(), O_RDONLY);
+            if (descriptor == -1)
+                throw std::runtime_error("could not open " + path);
+
+            struct stat status;
+            if (::fstat(descriptor, &status) == -1)
+            {
+                ::close(descriptor);
+                throw std::runtime_error("could not stat " + path);
+            }
+
+            byteCount = static_cast<std::size_t>(status.st_size);
+            if (byteCount > 0)
+            {
+                mapping = ::mmap(nullptr, byteCount, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (mapping == MAP_FAILED)
+                {
+                    ::close(descriptor);
+                    throw std::runtime_error("could not map " + path);
+                }
+            }
+
+            // The mapping keeps the file alive, the descriptor is no longer needed
+            ::close(descriptor);
+
+            adviseSequential();
+        }
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        MemoryMappedFile(MemoryMappedFile&& rhs) :
+            mapping(std::exchange(rhs.mapping, nullptr)),
+            byteCount(std::exchange(rhs.byteCount, 0))
+        {
+
+        }
+
+        MemoryMappedFile& operator=(MemoryMappedFile&& rhs)
+        {
+            if (this != &rhs)
+            {
+                unmap();
+                mapping = std::exchange(rhs.mapping, nullptr);
+                byteCount = std::exchange(rhs.byteCount, 0);
+            }
+
+            return *this;
+        }
+
+        ~MemoryMappedFile()
+        {
+            unmap();
+        }
+
+        //! Hint the kernel the mapping will be swept front to back, so it prefetches ahead
+        void adviseSequential()
+        {
+            if (mapping)
+                ::madvise(mapping, byteCount, MADV_SEQUENTIAL);
+        }
+
+        //! Hint the kernel the mapping will be accessed randomly, e.g. for interpolated lookups
+        void adviseRandom()
+        {
+            if (mapping)
+                ::madvise(mapping, byteCount, MADV_RANDOM);
+        }
+
+        //! The first sample of the file
+        const T* begin() const { return data(); }
+
+        //! One past the last whole sample of the file
+        const T* end() const { return data() + size(); }
+
+        //! The mapped samples
+        const T* data() const { return static_cast<const T*>(mapping); }
+
+        //! Access one of the samples
+        const T& operator[](std::size_t index) const { return data()[index]; }
+
+        //! The number of whole samples in the file
+        std::size_t size() const { return byteCount / sizeof(T); }
+
+        //! Does the file hold no samples at all?
+        bool empty() const { return size() == 0; }
+
+    private:
+        //! Release the mapping, if any
+        void unmap()
+        {
+            if (mapping)
+                ::munmap(mapping, byteCount);
+        }
+
+    private:
+        //! The start of the mapping, or nullptr for an empty file
+        void* mapping = nullptr;
+
+        //! The size of the mapping in bytes
+        std::size_t byteCount = 0;
+    };
+}
+
+#endif
+
+#endif
@@ -11,6 +11,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <numeric>
 #include <stdexcept>
 
@@ -31,12 +33,128 @@ namespace math
     }
     
     //! Normalize a range
+    /*! Works in tiles: each tile is scanned for its peak and scaled right after, while it is
+        still cache-hot, instead of streaming the whole range through memory twice. When a later
+        tile raises the peak, the output written so far is corrected by the ratio of the old and
+        new peak — for most signals the peak settles early, so nearly every sample is touched
+        once. The output therefore has to be a mutable forward range, not a pure output iterator.
+        Writing to the input range itself is fine. */
     template <typename InputIterator, typename OutputIterator>
     void normalize(InputIterator inBegin, InputIterator inEnd, OutputIterator outBegin)
     {
-        const auto absoluteExtrema = std::abs(*findExtrema(inBegin, inEnd));
-        const auto factor = 1.0 / absoluteExtrema;
-        std::transform(inBegin, inEnd, outBegin, [&](const auto& x){ return x * factor; });
+        using T = typename std::iterator_traits<InputIterator>::value_type;
+        constexpr std::size_t tileSize = 4096;
+
+        T peak = 0;
+        auto in = inBegin;
+        auto out = outBegin;
+
+        while (in != inEnd)
+        {
+            // Scan one tile for its peak
+            auto tileEnd = in;
+            T tilePeak = 0;
+            for (std::size_t i = 0; i < tileSize && tileEnd != inEnd; ++i, ++tileEnd)
+            {
+                const auto value = std::abs(*tileEnd);
+                if (value > tilePeak)
+                    tilePeak = value;
+            }
+
+            // A louder tile invalidates the output written so far; correct it by the peak ratio
+            if (tilePeak > peak)
+            {
+                if (peak > 0)
+                {
+                    const auto correction = peak / tilePeak;
+                    for (auto it = outBegin; it != out; ++it)
+                        *it = *it * correction;
+                }
+
+                peak = tilePeak;
+            }
+
+            // Scale the tile just scanned, while it is still in cache
+            const auto factor = 1.0 / peak;
+            for (; in != tileEnd; ++in, ++out)
+                *out = *in * factor;
+        }
+    }
+
+    //! Normalize a range in place, skipping the scaling when it would be a no-op
+    /*! When the peak is already within epsilon of one, the samples are left untouched and the
+        scaling sweep — and its dirtying of every cache line — is skipped entirely */
+    template <typename Iterator>
+    void normalize(Iterator begin, Iterator end, double epsilon = 0)
+    {
+        const auto peak = findAbsolutePeak(begin, end);
+        if (std::abs(peak - 1) <= epsilon)
+            return;
+
+        const auto factor = 1.0 / peak;
+        std::transform(begin, end, begin, [&](const auto& x){ return x * factor; });
+    }
+
+    //! Normalize a strided channel, e.g. one channel within an interleaved buffer
+    /*! Reads size samples at the given stride and writes them normalized at the output stride */
+    template <typename InputIterator, typename OutputIterator>
+    void normalize(InputIterator inBegin, std::size_t inStride, std::size_t size, OutputIterator outBegin, std::size_t outStride)
+    {
+        // Find the absolute peak over the strided samples
+        typename std::iterator_traits<InputIterator>::value_type peak = 0;
+        auto in = inBegin;
+        for (std::size_t i = 0; i < size; ++i, std::advance(in, inStride))
+        {
+            const auto value = std::abs(*in);
+            if (value > peak)
+                peak = value;
+        }
+
+        const auto factor = 1.0 / peak;
+
+        in = inBegin;
+        auto out = outBegin;
+        for (std::size_t i = 0; i < size; ++i, std::advance(in, inStride), std::advance(out, outStride))
+            *out = *in * factor;
+    }
+
+    //! Normalize a strided channel area, so the integral of the channel equals one
+    /*! @throw std::runtime_error if the area equals zero */
+    template <typename InputIterator, typename OutputIterator>
+    void normalizeArea(InputIterator inBegin, std::size_t inStride, std::size_t size, OutputIterator outBegin, std::size_t outStride)
+    {
+        typename std::iterator_traits<InputIterator>::value_type integral = 0;
+        auto in = inBegin;
+        for (std::size_t i = 0; i < size; ++i, std::advance(in, inStride))
+            integral += *in;
+
+        if (!integral)
+            throw std::runtime_error("area equals zero");
+
+        in = inBegin;
+        auto out = outBegin;
+        for (std::size_t i = 0; i < size; ++i, std::advance(in, inStride), std::advance(out, outStride))
+            *out = *in / integral;
+    }
+
+    //! Normalize each channel of an interleaved range independently
+    /*! Every channel is scaled by its own peak */
+    template <typename InputIterator, typename OutputIterator>
+    void normalizeChannels(InputIterator inBegin, InputIterator inEnd, OutputIterator outBegin, std::size_t channels)
+    {
+        const auto frames = std::distance(inBegin, inEnd) / static_cast<std::ptrdiff_t>(channels);
+        for (std::size_t channel = 0; channel < channels; ++channel)
+            normalize(std::next(inBegin, channel), channels, frames, std::next(outBegin, channel), channels);
+    }
+
+    //! Normalize the area of each channel of an interleaved range independently
+    /*! @throw std::runtime_error if one of the channel areas equals zero */
+    template <typename InputIterator, typename OutputIterator>
+    void normalizeAreaChannels(InputIterator inBegin, InputIterator inEnd, OutputIterator outBegin, std::size_t channels)
+    {
+        const auto frames = std::distance(inBegin, inEnd) / static_cast<std::ptrdiff_t>(channels);
+        for (std::size_t channel = 0; channel < channels; ++channel)
+            normalizeArea(std::next(inBegin, channel), channels, frames, std::next(outBegin, channel), channels);
     }
 }
 
@@ -0,0 +1,230 @@
+//
+//  parallel.hpp
+//  Math
+//
+//  Copyright © 2015-2016 Dsperados (info@dsperados.com). All rights reserved.
+//  Licensed under the BSD 3-clause license.
+//
+
+#ifndef DSPERADOS_MATH_PARALLEL_HPP
+#define DSPERADOS_MATH_PARALLEL_HPP
+
+// This header is opt-in: including <execution> ties the translation unit to the standard
+// library's parallel runtime (e.g. TBB with libstdc++), so the policy-taking overloads live
+// here instead of in the headers of the algorithms themselves.
+#if __has_include(<execution>)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "analysis.hpp"
+#include "interleave.hpp"
+
+#ifdef __cpp_lib_execution
+
+namespace math
+{
+    //! Calculate the mean, distributing the work with an execution policy
+    template <typename T, typename ExecutionPolicy, typename Iterator>
+    T mean(ExecutionPolicy&& policy, Iterator begin, Iterator end)
+    {
+        return std::reduce(policy, begin, end, T(0)) / static_cast<T>(std::distance(begin, end));
+    }
+
+    //! Calculate the mean square, distributing the work with an execution policy
+    template <typename T, typename ExecutionPolicy, typename Iterator>
+    T meanSquare(ExecutionPolicy&& policy, Iterator begin, Iterator end)
+    {
+        return std::transform_reduce(policy, begin, end, T(0), std::plus<>(), [](const T& x){ return x * x; }) / static_cast<T>(std::distance(begin, end));
+    }
+
+    //! Calculate the root mean square, distributing the work with an execution policy
+    template <typename T, typename ExecutionPolicy, typename Iterator>
+    T rootMeanSquare(ExecutionPolicy&& policy, Iterator begin, Iterator end)
+    {
+        return std::sqrt(meanSquare<T>(policy, begin, end));
+    }
+
+    //! Normalize an area, distributing the work with an execution policy
+    /*! @throw std::runtime_error if the integral of the signal equals zero */
+    template <typename ExecutionPolicy, typename InputIterator, typename OutputIterator>
+    void normalizeArea(ExecutionPolicy&& policy, InputIterator inBegin, InputIterator inEnd, OutputIterator outBegin)
+    {
+        auto integral = std::reduce(policy, inBegin, inEnd, typename std::iterator_traits<InputIterator>::value_type{0});
+
+        if (!integral)
+            throw std::runtime_error("area equals zero");
+
+        std::transform(policy, inBegin, inEnd, outBegin, [=](const auto& x){ return x / integral; });
+    }
+
+    //! Normalize a range, distributing the work with an execution policy
+    template <typename ExecutionPolicy, typename InputIterator, typename OutputIterator>
+    void normalize(ExecutionPolicy&& policy, InputIterator inBegin, InputIterator inEnd, OutputIterator outBegin)
+    {
+        using T = typename std::iterator_traits<InputIterator>::value_type;
+        const auto absoluteExtrema = std::transform_reduce(policy, inBegin, inEnd, T{0},
+                                                           [](const T& a, const T& b){ return std::max(a, b); },
+                                                           [](const T& x){ return std::abs(x); });
+        const auto factor = 1.0 / absoluteExtrema;
+        std::transform(policy, inBegin, inEnd, outBegin, [=](const auto& x){ return x * factor; });
+    }
+
+    //! The number of threads an execution policy spreads hand-chunked work over
+    /*! The standard algorithms chunk by themselves; the scanners and (de)interleavers below
+        chunk manually — on one thread for the sequenced policy, one per core otherwise */
+    template <typename ExecutionPolicy>
+    std::size_t executionThreadCount(ExecutionPolicy&&)
+    {
+        if (std::is_same<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>::value)
+            return 1;
+
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    //! Scan a range for extrema positions in overlapping chunks, merging the results in order
+    /*! The chunks overlap one sample on either side, so every sample keeps both of its
+        neighbours and the merged positions match the serial scan exactly — the same scheme
+        as the threaded envelope extraction in spline.hpp */
+    template <typename Iterator, typename Scan>
+    std::vector<size_t> chunkedExtremaScan(Iterator begin, Iterator end, std::size_t threadCount, Scan scan)
+    {
+        const std::size_t size = std::distance(begin, end);
+        if (threadCount < 2 || size < threadCount * 3)
+            return scan(begin, end);
+
+        const auto chunkSize = (size + threadCount - 1) / threadCount;
+        std::vector<std::future<std::vector<size_t>>> futures;
+        for (std::size_t start = 0; start < size; start += chunkSize)
+        {
+            const auto stop = std::min(start + chunkSize, size);
+            futures.emplace_back(std::async(std::launch::async, [&, start, stop]
+            {
+                const auto overlapStart = start > 0 ? start - 1 : 0;
+                const auto found = scan(std::next(begin, overlapStart), std::next(begin, std::min(stop + 1, size)));
+
+                // Rebase the positions, dropping those belonging to the neighbouring chunk
+                std::vector<size_t> positions;
+                for (auto& position : found)
+                {
+                    const auto global = position + overlapStart;
+                    if (global >= start && global < stop)
+                        positions.emplace_back(global);
+                }
+
+                return positions;
+            }));
+        }
+
+        std::vector<size_t> positions;
+        for (auto& future : futures)
+        {
+            const auto part = future.get();
+            positions.insert(positions.end(), part.begin(), part.end());
+        }
+
+        return positions;
+    }
+
+    //! Find the local minima of a signal, distributing the work with an execution policy
+    template <typename ExecutionPolicy, typename Iterator>
+    std::vector<size_t> findLocalMinimaPositions(ExecutionPolicy&& policy, Iterator begin, Iterator end)
+    {
+        return chunkedExtremaScan(begin, end, executionThreadCount(policy), [](auto begin, auto end){ return findLocalMinimaPositions(begin, end); });
+    }
+
+    //! Find the local maxima of a signal, distributing the work with an execution policy
+    template <typename ExecutionPolicy, typename Iterator>
+    std::vector<size_t> findLocalMaximaPositions(ExecutionPolicy&& policy, Iterator begin, Iterator end)
+    {
+        return chunkedExtremaScan(begin, end, executionThreadCount(policy), [](auto begin, auto end){ return findLocalMaximaPositions(begin, end); });
+    }
+
+    //! Count the number of zero crossings, distributing the work with an execution policy
+    /*! Pairs every sample with its successor, so crossings on chunk boundaries are counted
+        exactly once no matter how the policy splits the range */
+    template <typename ExecutionPolicy, typename Iterator>
+    size_t countZeroCrossings(ExecutionPolicy&& policy, Iterator begin, Iterator end)
+    {
+        if (std::distance(begin, end) < 2)
+            return 0;
+
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        return std::transform_reduce(policy, begin, std::prev(end), std::next(begin), size_t{0}, std::plus<>(),
+                                     [](const T& a, const T& b){ return std::signbit(a) != std::signbit(b) ? size_t{1} : size_t{0}; });
+    }
+
+    //! Interleave any number of channels, distributing the frames with an execution policy
+    /*! Every chunk of frames is independent, so the chunks only need their iterators offset
+     @warning The channel and output iterators should be random access */
+    template <typename ExecutionPolicy, class ChannelIt, class OutputIt>
+    void interleave(ExecutionPolicy&& policy, const std::vector<ChannelIt>& channels, std::size_t frames, OutputIt outBegin)
+    {
+        const auto threadCount = executionThreadCount(policy);
+        if (threadCount < 2 || frames < threadCount)
+            return interleave(channels, frames, outBegin);
+
+        const auto chunkSize = (frames + threadCount - 1) / threadCount;
+        std::vector<std::future<void>> futures;
+        for (std::size_t start = 0; start < frames; start += chunkSize)
+        {
+            const auto stop = std::min(start + chunkSize, frames);
+            futures.emplace_back(std::async(std::launch::async, [&, start, stop]
+            {
+                auto heads = channels;
+                for (auto& head : heads)
+                    std::advance(head, start);
+
+                interleave(heads, stop - start, std::next(outBegin, start * channels.size()));
+            }));
+        }
+
+        for (auto& future : futures)
+            future.get();
+    }
+
+    //! Deinterleave a range into channels, distributing the frames with an execution policy
+    /*! Every chunk of frames is independent, so the chunks only need their iterators offset
+     @warning The input and channel iterators should be random access */
+    template <typename ExecutionPolicy, class InputIt, class ChannelIt>
+    void deinterleave(ExecutionPolicy&& policy, InputIt inBegin, InputIt inEnd, const std::vector<ChannelIt>& channels)
+    {
+        const std::size_t frames = std::distance(inBegin, inEnd) / channels.size();
+        const auto threadCount = executionThreadCount(policy);
+        if (threadCount < 2 || frames < threadCount)
+            return deinterleave(inBegin, inEnd, channels);
+
+        const auto chunkSize = (frames + threadCount - 1) / threadCount;
+        std::vector<std::future<void>> futures;
+        for (std::size_t start = 0; start < frames; start += chunkSize)
+        {
+            const auto stop = std::min(start + chunkSize, frames);
+            futures.emplace_back(std::async(std::launch::async, [&, start, stop]
+            {
+                auto heads = channels;
+                for (auto& head : heads)
+                    std::advance(head, start);
+
+                deinterleave(std::next(inBegin, start * channels.size()), std::next(inBegin, stop * channels.size()), heads);
+            }));
+        }
+
+        for (auto& future : futures)
+            future.get();
+    }
+}
+
+#endif
+#endif
+
+#endif
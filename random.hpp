@@ -9,8 +9,13 @@
 #ifndef DSPERADOS_MATH_RANDOM_HPP
 #define DSPERADOS_MATH_RANDOM_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <random>
+#include <utility>
 #include <type_traits>
 #include <vector>
 
@@ -18,6 +23,45 @@
 
 namespace math
 {
+    //! Fast xorshift64* engine for bulk random generation
+    /*! Satisfies UniformRandomBitGenerator, so it plugs into the standard distributions and
+        the generate functions below. A draw costs three shifts and a multiply, considerably
+        cheaper than mt19937 for noise blocks and dither. Not cryptographically secure. */
+    class Xorshift64Engine
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        //! Construct the engine with a seed
+        /*! A zero seed would lock the recurrence at zero, so it is bumped to one */
+        explicit Xorshift64Engine(result_type seed = 88172645463325252ull) :
+            state(seed ? seed : 1)
+        {
+
+        }
+
+        //! Generate the next 64 random bits
+        result_type operator()()
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            return state * 2685821657736338717ull;
+        }
+
+        //! The smallest value operator() can return
+        /*! Never zero, because the state never reaches zero and the multiplier is odd */
+        static constexpr result_type min() { return 1; }
+
+        //! The biggest value operator() can return
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    private:
+        //! The state of the recurrence
+        result_type state = 1;
+    };
+
     //! Generate a random integral uniform sample
     template <typename T, typename Engine, typename Min, typename Max>
     std::enable_if_t<std::is_integral<T>::value, T> generateUniformRandom(const Min& a, const Max& b, Engine& engine)
@@ -32,15 +76,74 @@ namespace math
         return std::uniform_real_distribution<T>(a, b)(engine);
     }
     
+    //! Fill caller-owned storage with random uniform samples
+    /*! Fills [first, last) without allocating, so pooled buffers can be reused on real-time threads */
+    template <typename OutputIterator, typename Engine, typename Min, typename Max>
+    void generateUniformRandom(OutputIterator first, OutputIterator last, const Min& a, const Max& b, Engine& engine)
+    {
+        using T = typename std::iterator_traits<OutputIterator>::value_type;
+        std::generate(first, last, [&]{ return generateUniformRandom<T>(a, b, engine); });
+    }
+
     //! Generate a random uniform buffer
     template <typename T, typename Engine, typename Min, typename Max>
     std::vector<T> generateUniformRandomBuffer(std::size_t size, const Min& a, const Max& b, Engine& engine)
     {
         std::vector<T> result(size);
-        std::generate(result.begin(), result.end(), [&]{ return generateUniformRandom<T>(a, b, engine); });
-        
+        generateUniformRandom(result.begin(), result.end(), a, b, engine);
+
         return result;
     }
+
+    //! Generate a random uniform buffer using a custom allocator
+    template <typename T, typename Allocator, typename Engine, typename Min, typename Max>
+    std::vector<T, Allocator> generateUniformRandomBuffer(std::size_t size, const Allocator& allocator, const Min& a, const Max& b, Engine& engine)
+    {
+        std::vector<T, Allocator> result(size, T{}, allocator);
+        generateUniformRandom(result.begin(), result.end(), a, b, engine);
+
+        return result;
+    }
+
+    //! Generator for streams of uniform random samples
+    /*! Holds on to its engine and distribution, so drawing a block doesn't reconstruct the
+        distribution per sample like the free generate functions do
+
+        @code{cpp}
+        UniformRandomGenerator<float, Xorshift64Engine> noise(-1, 1);
+
+        std::vector<float> block(512);
+        noise.generate(block.begin(), block.end());
+        @endcode */
+    template <typename T, typename Engine = std::mt19937>
+    class UniformRandomGenerator
+    {
+    public:
+        //! Construct a generator emitting samples in [a, b]
+        UniformRandomGenerator(const T& a, const T& b, Engine engine = Engine()) :
+            engine(std::move(engine)),
+            distribution(a, b)
+        {
+
+        }
+
+        //! Draw the next sample
+        T operator()() { return distribution(engine); }
+
+        //! Fill a block with random samples
+        template <typename OutputIterator>
+        void generate(OutputIterator first, OutputIterator last)
+        {
+            std::generate(first, last, [&]{ return distribution(engine); });
+        }
+
+    private:
+        //! The engine the random bits are drawn from
+        Engine engine;
+
+        //! The distribution shaping the bits into samples
+        std::conditional_t<std::is_integral<T>::value, std::uniform_int_distribution<T>, std::uniform_real_distribution<T>> distribution;
+    };
 }
 
 #endif
@@ -0,0 +1,157 @@
+//
+//  resample.hpp
+//  Math
+//
+//  Copyright © 2015-2016 Dsperados (info@dsperados.com). All rights reserved.
+//  Licensed under the BSD 3-clause license.
+//
+
+#ifndef DSPERADOS_MATH_RESAMPLE_HPP
+#define DSPERADOS_MATH_RESAMPLE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "access.hpp"
+#include "interpolation.hpp"
+
+namespace math
+{
+    //! Engine for resampling at a fixed conversion ratio
+    /*! The read position is kept as a separate integer and fraction, advanced by precomputed
+        steps, so the per-sample path is an add and a carry instead of the multiply/floor that
+        computing each index from scratch would cost. The phase carries over between process()
+        calls, so consecutive blocks of a stream join seamlessly.
+
+        process() reads every output sample from the range it is handed, so the caller has to
+        keep the whole input around. For block-based streams, stream() consumes its input
+        instead: it carries the few samples an interpolation stencil can still reach over to
+        the next call and drops the rest.
+
+        @code{cpp}
+        Resampler<> resampler(44100.0 / 48000.0);
+
+        std::vector<float> out(480);
+        resampler.process(in.begin(), in.end(), out.begin(), out.end());
+        @endcode */
+    template <typename Interpolator = LinearInterpolation>
+    class Resampler
+    {
+    public:
+        //! Construct for a fixed conversion ratio
+        /*! @param factor The input increment per output sample (input rate / output rate) */
+        Resampler(double factor, Interpolator interpolator = Interpolator()) :
+            interpolator(interpolator),
+            integerStep(std::floor(factor)),
+            fractionalStep(factor - std::floor(factor))
+        {
+
+        }
+
+        //! Resample an input range into caller-owned storage
+        /*! Writes one interpolated sample per output position. Only stencils overlapping the
+            edges of the input go through the accessor; the interior runs without boundary
+            handling, like the batch interpolate() */
+        template <class InputIterator, class OutputIterator, class Accessor = ClampedAccess>
+        void process(InputIterator begin, InputIterator end, OutputIterator outBegin, OutputIterator outEnd, Accessor accessor = Accessor())
+        {
+            const std::ptrdiff_t size = std::distance(begin, end);
+
+            // The number of samples the interpolator touches before and after the truncated index
+            constexpr std::ptrdiff_t before = Interpolator::size / 2 - 1;
+            constexpr std::ptrdiff_t after = Interpolator::size - before - 1;
+
+            for (auto it = outBegin; it != outEnd; ++it)
+            {
+                const auto index = integerPhase + fractionalPhase;
+
+                if (integerPhase >= before && integerPhase + after < size)
+                    *it = interpolator(begin, end, index, UncheckedAccess());
+                else
+                    *it = interpolator(begin, end, index, accessor);
+
+                // Advance the phase, carrying the fraction into the integer part
+                fractionalPhase += fractionalStep;
+                integerPhase += integerStep;
+                if (fractionalPhase >= 1)
+                {
+                    fractionalPhase -= 1;
+                    ++integerPhase;
+                }
+            }
+        }
+
+        //! Resample one block of a stream, consuming the input
+        /*! Appends the block to an internal history buffer and writes every output sample whose
+            interpolation stencil is fully available; samples near the leading edge wait for the
+            next block instead of being computed from clamped data. Input no stencil can reach
+            anymore is dropped, so the buffer stays a few samples long regardless of how much
+            has been streamed. The accessor is only used at the very start of the stream
+         @return The output iterator one past the last sample written */
+        template <class InputIterator, class OutputIterator, class Accessor = ClampedAccess>
+        OutputIterator stream(InputIterator begin, InputIterator end, OutputIterator outBegin, Accessor accessor = Accessor())
+        {
+            buffer.insert(buffer.end(), begin, end);
+
+            // The number of samples the interpolator touches before and after the truncated index
+            constexpr std::ptrdiff_t before = Interpolator::size / 2 - 1;
+            constexpr std::ptrdiff_t after = Interpolator::size - before - 1;
+
+            const std::ptrdiff_t size = buffer.size();
+            while (integerPhase + after < size)
+            {
+                const auto index = integerPhase + fractionalPhase;
+
+                if (integerPhase >= before)
+                    *outBegin = interpolator(buffer.begin(), buffer.end(), index, UncheckedAccess());
+                else
+                    *outBegin = interpolator(buffer.begin(), buffer.end(), index, accessor);
+                ++outBegin;
+
+                // Advance the phase, carrying the fraction into the integer part
+                fractionalPhase += fractionalStep;
+                integerPhase += integerStep;
+                if (fractionalPhase >= 1)
+                {
+                    fractionalPhase -= 1;
+                    ++integerPhase;
+                }
+            }
+
+            // Drop the history no stencil can reach anymore, rebasing the phase onto what remains
+            const auto drop = std::max<std::ptrdiff_t>(0, integerPhase - before);
+            buffer.erase(buffer.begin(), buffer.begin() + drop);
+            integerPhase -= drop;
+
+            return outBegin;
+        }
+
+        //! Jump back to the start of the input
+        void reset()
+        {
+            integerPhase = 0;
+            fractionalPhase = 0;
+            buffer.clear();
+        }
+
+    private:
+        //! The interpolator reading between input samples
+        Interpolator interpolator;
+
+        //! The whole and fractional input increments per output sample
+        std::ptrdiff_t integerStep = 0;
+        double fractionalStep = 0;
+
+        //! The current read position, split into integer and fraction
+        std::ptrdiff_t integerPhase = 0;
+        double fractionalPhase = 0;
+
+        //! The carried-over input samples for stream()
+        std::vector<double> buffer;
+    };
+}
+
+#endif
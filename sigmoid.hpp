@@ -9,6 +9,7 @@
 #ifndef DSPERADOS_MATH_SIGMOID_HPP
 #define DSPERADOS_MATH_SIGMOID_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -53,7 +54,7 @@ namespace math
     {
         if (negativeFactor <= 0 || positiveFactor <=0)
             throw std::runtime_error("Factor <= 0");
-        
+
         if (x > 0)
             return (1 - std::exp(-x * positiveFactor)) / (1 - std::exp(-positiveFactor)) ;
         else if (x < 0)
@@ -61,6 +62,155 @@ namespace math
         else
             return 0;
     }
+
+    //! Function object for the normalized sigmoid
+    /*! Computes the normalization terms, which only depend on the shape factors, once at
+        construction instead of on every call like sigmoid() does
+     @throw std::runtime_error if one of the factors <= 0 */
+    template <typename T>
+    class Sigmoid
+    {
+    public:
+        Sigmoid(double negativeFactor, double positiveFactor) :
+            negativeFactor(negativeFactor),
+            positiveFactor(positiveFactor)
+        {
+            if (negativeFactor <= 0 || positiveFactor <= 0)
+                throw std::runtime_error("Factor <= 0");
+
+            negativeNormalization = (1 + std::abs(negativeFactor)) / negativeFactor;
+            positiveNormalization = (1 + std::abs(positiveFactor)) / positiveFactor;
+        }
+
+        T operator()(const T& x) const
+        {
+            if (x > 0)
+                return ((x * positiveFactor) / (1 + std::abs(x * positiveFactor))) * positiveNormalization;
+            else if (x < 0)
+                return ((x * negativeFactor) / (1 + std::abs(x * negativeFactor))) * negativeNormalization;
+            else
+                return 0;
+        }
+
+        //! Shape a whole buffer of samples
+        template <typename InputIterator, typename OutputIterator>
+        void process(InputIterator begin, InputIterator end, OutputIterator outBegin) const
+        {
+            std::transform(begin, end, outBegin, [&](const T& x){ return (*this)(x); });
+        }
+
+    private:
+        double negativeFactor = 1;
+        double positiveFactor = 1;
+
+        //! The reciprocals of the sigmoid values at x = ±1
+        double negativeNormalization = 1;
+        double positiveNormalization = 1;
+    };
+
+    //! Transcendental policy calling into the standard library at full precision
+    /*! The default for SigmoidTan and SigmoidExp; substitute fast::Transcendentals from
+        fastmath.hpp to use the approximate kernels instead */
+    struct StdTranscendentals
+    {
+        template <typename T>
+        static T atan(T x) { return std::atan(x); }
+
+        template <typename T>
+        static T exp(T x) { return std::exp(x); }
+    };
+
+    //! Function object for the normalized sigmoid using tan
+    /*! Hoists the atan() of the shape factors out of the per-sample path. The atan itself is
+        computed by the Transcendentals policy, so the approximate kernels in fastmath.hpp can
+        be substituted for the standard library
+     @throw std::runtime_error if one of the factors <= 0 */
+    template <typename T, typename Transcendentals = StdTranscendentals>
+    class SigmoidTan
+    {
+    public:
+        SigmoidTan(double negativeFactor, double positiveFactor) :
+            negativeFactor(negativeFactor),
+            positiveFactor(positiveFactor)
+        {
+            if (negativeFactor <= 0 || positiveFactor <= 0)
+                throw std::runtime_error("Factor <= 0");
+
+            negativeNormalization = 1 / std::atan(negativeFactor);
+            positiveNormalization = 1 / std::atan(positiveFactor);
+        }
+
+        T operator()(const T& x) const
+        {
+            if (x > 0)
+                return Transcendentals::atan(x * positiveFactor) * positiveNormalization;
+            else if (x < 0)
+                return Transcendentals::atan(x * negativeFactor) * negativeNormalization;
+            else
+                return 0;
+        }
+
+        //! Shape a whole buffer of samples
+        template <typename InputIterator, typename OutputIterator>
+        void process(InputIterator begin, InputIterator end, OutputIterator outBegin) const
+        {
+            std::transform(begin, end, outBegin, [&](const T& x){ return (*this)(x); });
+        }
+
+    private:
+        double negativeFactor = 1;
+        double positiveFactor = 1;
+
+        //! The reciprocals of the atan at the shape factors
+        double negativeNormalization = 1;
+        double positiveNormalization = 1;
+    };
+
+    //! Function object for the normalized sigmoid using exp
+    /*! Hoists the exp() of the shape factors out of the per-sample path. The exp itself is
+        computed by the Transcendentals policy, so the approximate kernels in fastmath.hpp can
+        be substituted for the standard library
+     @throw std::runtime_error if one of the factors <= 0 */
+    template <typename T, typename Transcendentals = StdTranscendentals>
+    class SigmoidExp
+    {
+    public:
+        SigmoidExp(double negativeFactor, double positiveFactor) :
+            negativeFactor(negativeFactor),
+            positiveFactor(positiveFactor)
+        {
+            if (negativeFactor <= 0 || positiveFactor <= 0)
+                throw std::runtime_error("Factor <= 0");
+
+            negativeNormalization = 1 / (1 - std::exp(-negativeFactor));
+            positiveNormalization = 1 / (1 - std::exp(-positiveFactor));
+        }
+
+        T operator()(const T& x) const
+        {
+            if (x > 0)
+                return (1 - Transcendentals::exp(-x * positiveFactor)) * positiveNormalization;
+            else if (x < 0)
+                return (-1 + Transcendentals::exp(x * negativeFactor)) * negativeNormalization;
+            else
+                return 0;
+        }
+
+        //! Shape a whole buffer of samples
+        template <typename InputIterator, typename OutputIterator>
+        void process(InputIterator begin, InputIterator end, OutputIterator outBegin) const
+        {
+            std::transform(begin, end, outBegin, [&](const T& x){ return (*this)(x); });
+        }
+
+    private:
+        double negativeFactor = 1;
+        double positiveFactor = 1;
+
+        //! The reciprocals of 1 - exp(-factor)
+        double negativeNormalization = 1;
+        double positiveNormalization = 1;
+    };
 }
 
 #endif /* DSPERADOS_MATH_SIGMOID_HPP */
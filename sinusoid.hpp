@@ -9,33 +9,206 @@
 #ifndef DSPERADOS_MATH_SINUSOID_HPP
 #define DSPERADOS_MATH_SINUSOID_HPP
 
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <iterator>
 #include <vector>
 
 #include "constants.hpp"
 
 namespace math
 {
+    //! Generate a sine wave in caller-owned storage
+    /*! Fills [first, last) with one cycle (times order), without allocating. Use this instead
+        of generateSineBuffer() to reuse pooled buffers on real-time threads */
+    template <typename OutputIterator>
+    void generateSine(OutputIterator first, OutputIterator last, float order = 1, float amplitude = 1)
+    {
+        const auto size = std::distance(first, last);
+        std::size_t i = 0;
+        for (auto it = first; it != last; ++it, ++i)
+            *it = sin(i / static_cast<double>(size) * TAU<double> * order) * amplitude;
+    }
+
+    //! Generate a cosine wave in caller-owned storage
+    /*! Fills [first, last) with one cycle (times order), without allocating. Use this instead
+        of generateCosineBuffer() to reuse pooled buffers on real-time threads */
+    template <typename OutputIterator>
+    void generateCosine(OutputIterator first, OutputIterator last, float order = 1, float amplitude = 1)
+    {
+        const auto size = std::distance(first, last);
+        std::size_t i = 0;
+        for (auto it = first; it != last; ++it, ++i)
+            *it = cos((i / static_cast<double>(size)) * TAU<double> * order) * amplitude;
+    }
+
+    //! Incremental sinusoid generator
+    /*! Generates sinusoid samples with a complex phasor rotation recurrence, costing a few
+        multiply-adds per sample instead of a sin() call. The phase is continuous across calls,
+        so arbitrary-length blocks can be streamed one after another.
+
+        @code{cpp}
+        SinusoidGenerator<float> generator(TAU<double> * 440 / 44100);
+
+        std::vector<float> block(512);
+        generator.generate(block.begin(), block.end());
+        @endcode */
+    template <typename T>
+    class SinusoidGenerator
+    {
+    public:
+        //! Construct a generator
+        /*! @param angleIncrement The phase advance per sample, in radians */
+        SinusoidGenerator(double angleIncrement, double phase = 0, double amplitude = 1) :
+            amplitude(amplitude)
+        {
+            setAngleIncrement(angleIncrement);
+            setPhase(phase);
+        }
+
+        //! Change the phase advance per sample, in radians
+        void setAngleIncrement(double angleIncrement)
+        {
+            rotationReal = std::cos(angleIncrement);
+            rotationImaginary = std::sin(angleIncrement);
+        }
+
+        //! Jump to a given phase, in radians
+        void setPhase(double phase)
+        {
+            real = std::cos(phase);
+            imaginary = std::sin(phase);
+            sampleCount = 0;
+        }
+
+        //! Generate the next sine sample and advance the phase
+        T operator()()
+        {
+            const auto y = imaginary * amplitude;
+
+            // Rotate the phasor by the angle increment
+            const auto newReal = real * rotationReal - imaginary * rotationImaginary;
+            imaginary = real * rotationImaginary + imaginary * rotationReal;
+            real = newReal;
+
+            // Undo the magnitude drift of the recurrence every so often
+            if (++sampleCount >= 512)
+            {
+                sampleCount = 0;
+                const auto factor = 1.0 / std::sqrt(real * real + imaginary * imaginary);
+                real *= factor;
+                imaginary *= factor;
+            }
+
+            return y;
+        }
+
+        //! Fill a block with sine samples, continuing the phase of the previous block
+        template <typename OutputIterator>
+        void generate(OutputIterator first, OutputIterator last)
+        {
+            for (auto it = first; it != last; ++it)
+                *it = (*this)();
+        }
+
+    public:
+        //! The amplitude the samples are scaled by
+        double amplitude = 1;
+
+    private:
+        //! The phasor holding the current phase
+        double real = 1;
+        double imaginary = 0;
+
+        //! The rotation applied to the phasor each sample
+        double rotationReal = 1;
+        double rotationImaginary = 0;
+
+        //! Samples generated since the last renormalization
+        std::size_t sampleCount = 0;
+    };
+
     //! Generate a sine wave in a buffer
     template <typename T>
     std::vector<T> generateSineBuffer(std::size_t size, float order = 1, float amplitude = 1)
     {
         std::vector<T> buffer(size);
-        for (auto i = 0; i < size; ++i)
-            buffer[i] = sin(i / static_cast<double>(size) * TAU<double> * order) * amplitude;
-        
+        generateSine(buffer.begin(), buffer.end(), order, amplitude);
+
         return buffer;
     }
-    
+
     //! Generate a cosine wave in a buffer
     template <typename T>
     std::vector<T> generateCosineBuffer(std::size_t size, float order = 1, float amplitude = 1)
     {
         std::vector<T> buffer(size);
-        for (auto i = 0; i < size; ++i)
-            buffer[i] = cos((i / static_cast<double>(size)) * TAU<double> * order) * amplitude;
-        
+        generateCosine(buffer.begin(), buffer.end(), order, amplitude);
+
+        return buffer;
+    }
+
+    //! Compute the sine of an angle at compile time
+    /*! Taylor expansion after folding the angle into [-π, π]. Deviates less than 1e-9 from
+        std::sin, which is plenty for wavetable generation; std::sin itself is not constexpr. */
+    template <typename T>
+    constexpr T constexprSin(T x)
+    {
+        // Fold the angle into [-π, π]
+        x -= static_cast<long long>(x / TAU<T>) * TAU<T>;
+        if (x > PI<T>)
+            x -= TAU<T>;
+        else if (x < -PI<T>)
+            x += TAU<T>;
+
+        // Evaluate the Taylor series with Horner's scheme
+        const auto x2 = x * x;
+        T result = 1;
+        result = 1 - x2 / (20 * 21) * result;
+        result = 1 - x2 / (18 * 19) * result;
+        result = 1 - x2 / (16 * 17) * result;
+        result = 1 - x2 / (14 * 15) * result;
+        result = 1 - x2 / (12 * 13) * result;
+        result = 1 - x2 / (10 * 11) * result;
+        result = 1 - x2 / (8 * 9) * result;
+        result = 1 - x2 / (6 * 7) * result;
+        result = 1 - x2 / (4 * 5) * result;
+        result = 1 - x2 / (2 * 3) * result;
+
+        return x * result;
+    }
+
+    //! Generate a sine wavetable at compile time
+    /*! Constexpr counterpart of generateSineBuffer(), so static wavetables can live in the
+        binary instead of being computed at startup */
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> makeSineTable(float order = 1, float amplitude = 1)
+    {
+        std::array<T, N> table = {};
+        for (std::size_t i = 0; i < N; ++i)
+            table[i] = constexprSin(i / static_cast<double>(N) * TAU<double> * order) * amplitude;
+
+        return table;
+    }
+
+    //! Generate a sine wave in a buffer using a custom allocator
+    template <typename T, typename Allocator>
+    std::vector<T, Allocator> generateSineBuffer(std::size_t size, const Allocator& allocator, float order = 1, float amplitude = 1)
+    {
+        std::vector<T, Allocator> buffer(size, T{}, allocator);
+        generateSine(buffer.begin(), buffer.end(), order, amplitude);
+
+        return buffer;
+    }
+
+    //! Generate a cosine wave in a buffer using a custom allocator
+    template <typename T, typename Allocator>
+    std::vector<T, Allocator> generateCosineBuffer(std::size_t size, const Allocator& allocator, float order = 1, float amplitude = 1)
+    {
+        std::vector<T, Allocator> buffer(size, T{}, allocator);
+        generateCosine(buffer.begin(), buffer.end(), order, amplitude);
+
         return buffer;
     }
 }
@@ -9,8 +9,13 @@
 #ifndef DSPERADOS_MATH_SPLINE_HPP
 #define DSPERADOS_MATH_SPLINE_HPP
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <future>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "analysis.hpp"
@@ -19,205 +24,688 @@ namespace math
 {
     //! Cubic spline with control points
     /*! Utility class for generating cubic splines. One can add points along the spline, and then
-        retrieve interpolated values.
-     
+        retrieve interpolated values. The points are stored as structure-of-arrays: one contiguous
+        vector per coefficient, so sweeps touch only the coefficients they need and stream through
+        the cache line by line.
+
         @code{cpp}
         CubicSpline spline;
-     
+
         spline.emplace(0, 1);
         spline.emplace(1, 8);
         spline.emplace(2, -3);
-     
+
         cout << spline[1.124] << endl;
-        @endcode */
-    class CubicSpline
+        @endcode
+
+        The point and coefficient storage draws from the Allocator parameter, so the whole
+        spline can live in an Arena; see BasicCubicSpline(const Allocator&). The transient
+        solver scratch stays on the default allocator, since an arena never reclaims it. */
+    template <typename Allocator = std::allocator<float>>
+    class BasicCubicSpline
     {
     public:
+        BasicCubicSpline() = default;
+
+        //! Construct with a custom allocator for the point and coefficient storage
+        explicit BasicCubicSpline(const Allocator& allocator) :
+            positionData(allocator),
+            a(allocator),
+            b(allocator),
+            c(allocator),
+            d(allocator)
+        {
+
+        }
+
         //! Add a point to the spline
         /*! Every time a point is added, the coefficients will be recalculated.
-         @warning If you'll add more than one point, use the version of emplace() taking vectors */
+         @warning If you'll add more than one point, use the version of emplace() taking vectors,
+         or enable deferRecomputation() */
         void emplace(float x, float y)
         {
             emplacePoint(x, y);
-            
-            recomputeCoefficients();
+
+            invalidateOrRecompute();
         }
-        
+
         //! Emplace points and their values
-        template <class U>
-        void emplace(const std::vector<U>& x, const std::vector<float>& y)
+        template <class U, class UAllocator>
+        void emplace(const std::vector<U, UAllocator>& x, const std::vector<float>& y)
         {
             auto n = std::min(x.size(), y.size());
             for (auto i = 0; i < n; ++i)
                 emplacePoint(x[i], y[i]);
-            
-            recomputeCoefficients();
+
+            invalidateOrRecompute();
         }
-        
+
         //! Emplace points and their values by index
         /*! @param indices Indexes into the vector
          @param values y-values, per 1 x */
-        template <class U>
-        void emplaceByIndex(const std::vector<U>& indices, const std::vector<float>& values)
+        template <class U, class UAllocator>
+        void emplaceByIndex(const std::vector<U, UAllocator>& indices, const std::vector<float>& values)
         {
             auto n = std::min(indices.size(), values.size());
             for (auto i = 0; i < n; ++i)
                 emplacePoint(indices[i], values[indices[i]]);
-            
-            recomputeCoefficients();
+
+            invalidateOrRecompute();
+        }
+
+        //! Defer coefficient recomputation until the next read
+        /*! In deferred mode emplacing points only marks the coefficients as stale; the solve
+            runs once on the first read afterwards, so building a spline point-by-point is O(N)
+            instead of O(N²). Disabling deferral recomputes immediately if necessary. */
+        void deferRecomputation(bool enabled = true)
+        {
+            deferred = enabled;
+            if (!deferred)
+                recomputeIfNeeded();
         }
-        
+
+        //! Change the y value of an existing point, re-solving only the surrounding neighborhood
+        /*! The influence of a single point on the spline solution decays geometrically with
+            segment distance, so re-solving a window of a couple dozen segments on either side
+            reproduces the full solve to within floating-point precision, at O(radius) cost.
+         @return Whether a point at the given x existed */
+        bool setY(float x, float y, std::size_t radius = 16)
+        {
+            recomputeIfNeeded();
+
+            // Look up the point (the positions are kept sorted)
+            auto it = std::lower_bound(positionData.begin(), positionData.end(), x);
+            if (it == positionData.end() || *it != x)
+                return false;
+
+            const std::size_t index = std::distance(positionData.begin(), it);
+            a[index] = y;
+            recomputeNeighborhood(index, std::max<std::size_t>(radius, 2));
+
+            return true;
+        }
+
         //! Access one of the points on the spline
         /*! @param x The index being a floating-point, the output will automatically be interpolated */
         float operator[](double x) const
         {
+            recomputeIfNeeded();
+
             // If there are not points (and coefficients, return 0)
-            if (points.empty())
+            if (positionData.empty())
                 return 0;
-            
+
             // If we're before the first point, just return that point's y value
-            if (x < points.front().x)
-                return points.front().a;
-            
-            auto last = std::prev(points.end());
-            
-            // Find the right coefficients
-            auto it = std::find_if(std::next(points.rbegin()), points.rend(), [&](const auto& point){ return x >= point.x; });
-            if (it == points.rend())
-                return last->a;
-            
-            // Compute the fraction and fraction powered
-            const float f = x - it->x;
-            const auto f2 = f * f;
-            
-            // Return the spline interpolation
-            return it->a + (it->b * f) + (it->c * f2) + (it->d * f * f2);
+            if (x < positionData.front() || positionData.size() == 1)
+                return a.front();
+
+            // Binary search for the segment containing x and evaluate its polynomial
+            return evaluateSegment(findSegment(x), x);
         }
-        
+
         // Access a range of points on the spline
+        /*! The positions being monotonically increasing, the segment cursor only ever moves
+            forward, so a span over M positions costs O(N + M) instead of O(N · M) */
         std::vector<float> span(std::ptrdiff_t offset, size_t length)
         {
+            recomputeIfNeeded();
+
             std::vector<float> out(length);
-            
-            for (auto i = 0; i < length; ++i)
-                out[i] = (*this)[offset + i];
-            
+            fillSpan(offset, out);
+
             return out;
         }
-        
-        // Return iterators for ranged for-loops
-        auto begin() { return points.begin(); }
-        auto begin() const { return points.begin(); }
-        auto end() { return points.end(); }
-        auto end() const { return points.end(); }
-        
-    private:
-        //! A point in the spline
-        struct Point
-        {
-        public:
-            Point(float x, float y) : x(x), a(y) { }
-            
-            bool operator<(const Point& rhs) const { return x < rhs.x; }
-            
-        public:
-            float x = 0;
-            
-            float a = 0; // The same as y
-            float b = 0;
-            float c = 0;
-            float d = 0;
+
+        //! Access a range of points on the spline, using a custom allocator for the output
+        template <typename OutAllocator>
+        std::vector<float, OutAllocator> span(std::ptrdiff_t offset, size_t length, const OutAllocator& allocator)
+        {
+            recomputeIfNeeded();
+
+            std::vector<float, OutAllocator> out(length, 0.f, allocator);
+            fillSpan(offset, out);
+
+            return out;
+        }
+
+        //! Write a range of points on the spline into caller-owned storage
+        /*! Allocation-free counterpart of span(). Being const, multiple threads may evaluate
+            disjoint spans of an already solved spline concurrently */
+        template <typename OutputIterator>
+        void span(std::ptrdiff_t offset, OutputIterator first, OutputIterator last) const
+        {
+            recomputeIfNeeded();
+            fillSpan(offset, first, last);
+        }
+
+        //! The number of points on the spline
+        std::size_t size() const { return positionData.size(); }
+
+        //! The x positions of the points, sorted ascending
+        const std::vector<float, Allocator>& positions() const { recomputeIfNeeded(); return positionData; }
+
+        //! The y values of the points, in the same order as positions()
+        const std::vector<float, Allocator>& values() const { recomputeIfNeeded(); return a; }
+
+        //! Contiguous views of the polynomial coefficients, one vector per coefficient
+        struct Coefficients
+        {
+            const std::vector<float, Allocator>& a;
+            const std::vector<float, Allocator>& b;
+            const std::vector<float, Allocator>& c;
+            const std::vector<float, Allocator>& d;
         };
-        
+
+        //! Access the polynomial coefficients of all segments at once
+        Coefficients coefficients() const
+        {
+            recomputeIfNeeded();
+            return {a, b, c, d};
+        }
+
     private:
+        //! Fill a span with evaluated positions, advancing the segment cursor incrementally
+        template <typename Vector>
+        void fillSpan(std::ptrdiff_t offset, Vector& out) const
+        {
+            fillSpan(offset, out.begin(), out.end());
+        }
+
+        //! Fill an iterator range with evaluated positions, advancing the segment cursor incrementally
+        template <typename OutputIterator>
+        void fillSpan(std::ptrdiff_t offset, OutputIterator first, OutputIterator last) const
+        {
+            std::ptrdiff_t position = offset;
+
+            if (positionData.size() < 2)
+            {
+                for (auto it = first; it != last; ++it, ++position)
+                    *it = (*this)[position];
+
+                return;
+            }
+
+            // Find the segment containing the first position, then advance it incrementally
+            auto segment = findSegment(offset);
+            for (auto it = first; it != last; ++it, ++position)
+            {
+                const double x = position;
+                if (x < positionData.front())
+                {
+                    *it = a.front();
+                    continue;
+                }
+
+                while (segment + 2 < positionData.size() && positionData[segment + 1] <= x)
+                    ++segment;
+
+                *it = evaluateSegment(segment, x);
+            }
+        }
+
+        //! Find the index of the segment containing x (binary search)
+        /*! Positions before the first point map to the first segment
+         @warning The spline should hold at least two points */
+        std::size_t findSegment(double x) const
+        {
+            auto it = std::upper_bound(positionData.begin(), positionData.end(), x);
+
+            // The last point starts no segment of its own; positions beyond it extrapolate the final segment
+            return std::min<std::size_t>(std::max<std::ptrdiff_t>(std::distance(positionData.begin(), it) - 1, 0), positionData.size() - 2);
+        }
+
+        //! Evaluate the polynomial of a single segment
+        float evaluateSegment(std::size_t index, double x) const
+        {
+            // Compute the fraction and fraction powered
+            const float f = x - positionData[index];
+            const auto f2 = f * f;
+
+            // Return the spline interpolation
+            return a[index] + (b[index] * f) + (c[index] * f2) + (d[index] * f * f2);
+        }
+
         //! Emplace a new point, but don't recompute the coefficients
+        /*! Inserts at the sorted position, so the arrays never need a separate sort */
         void emplacePoint(float x, float y)
         {
-            auto it = find_if(points.begin(), points.end(), [&](const auto& point){ return point.x == x; });
-            if (it == points.end())
-                points.emplace_back(x, y);
+            auto it = std::lower_bound(positionData.begin(), positionData.end(), x);
+            if (it != positionData.end() && *it == x)
+            {
+                a[std::distance(positionData.begin(), it)] = y;
+                return;
+            }
+
+            const std::size_t index = std::distance(positionData.begin(), it);
+            positionData.insert(it, x);
+            a.insert(a.begin() + index, y);
+        }
+
+        //! Mark the coefficients as stale, or recompute them right away when not deferring
+        void invalidateOrRecompute()
+        {
+            if (deferred)
+                dirty = true;
             else
-                it->a = y;
+                recomputeCoefficients();
         }
-        
+
+        //! Recompute the coefficients if a deferred emplace left them stale
+        void recomputeIfNeeded() const
+        {
+            if (dirty)
+                recomputeCoefficients();
+        }
+
+        //! Recompute the coefficients around a single changed y value
+        /*! Re-solves the tridiagonal system on [index - radius, index + radius] only, keeping
+            the second-derivative values on the window boundary fixed. The scratch space is
+            local and sized to the window, so idle splines don't retain any */
+        void recomputeNeighborhood(std::size_t index, std::size_t radius) const
+        {
+            const auto n = positionData.size() - 1;
+            const std::size_t lo = index > radius ? index - radius : 0;
+            const std::size_t hi = std::min(index + radius, n);
+
+            // If the window covers the whole spline anyway, run the full solve
+            if (lo == 0 && hi == n && positionData.size() <= 2 * radius + 1)
+                return recomputeCoefficients();
+
+            // Rebuild the divided differences for the window; they are cheap to derive
+            // from the positions and values, so they aren't retained between solves
+            const auto count = hi - lo + 1;
+            std::vector<float> dx(count), alpha(count), l(count), mu(count), z(count);
+
+            for (auto i = lo; i < hi; ++i)
+                dx[i - lo] = positionData[i + 1] - positionData[i];
+
+            for (auto i = lo + 1; i < hi; ++i)
+                alpha[i - lo] = 3.0 * (a[i + 1] - a[i]) / dx[i - lo] - 3.0 * (a[i] - a[i - 1]) / dx[i - lo - 1];
+
+            // Forward sweep over the window, moving the fixed boundary c values to the right-hand side
+            for (auto i = lo + 1; i < hi; ++i)
+            {
+                const auto rhs = alpha[i - lo]
+                    - (i == lo + 1 ? dx[0] * c[lo] : 0.f)
+                    - (i == hi - 1 ? dx[i - lo] * c[hi] : 0.f);
+
+                l[i - lo] = 2.0 * (positionData[i + 1] - positionData[i - 1]) - (i == lo + 1 ? 0.f : dx[i - lo - 1] * mu[i - lo - 1]);
+                mu[i - lo] = dx[i - lo] / l[i - lo];
+                z[i - lo] = (rhs - (i == lo + 1 ? 0.f : dx[i - lo - 1] * z[i - lo - 1])) / l[i - lo];
+            }
+
+            // Back substitution for c, then b and d for the segments in the window
+            for (auto i = hi; i-- > lo + 1; )
+                c[i] = z[i - lo] - (i == hi - 1 ? 0.f : mu[i - lo] * c[i + 1]);
+
+            for (auto i = hi; i-- > lo; )
+            {
+                b[i] = (a[i + 1] - a[i]) / dx[i - lo] - dx[i - lo] * (c[i + 1] + 2.0 * c[i]) / 3.0;
+                d[i] = (c[i + 1] - c[i]) / (3 * dx[i - lo]);
+            }
+        }
+
         //! Recompute the coefficients
-        void recomputeCoefficients()
+        /*! The solver scratch space is local to the call, so a live spline only retains the
+            coefficient vectors themselves */
+        void recomputeCoefficients() const
         {
-            if (points.size() <= 1)
+            dirty = false;
+
+            b.assign(positionData.size(), 0);
+            c.assign(positionData.size(), 0);
+            d.assign(positionData.size(), 0);
+
+            if (positionData.size() <= 1)
                 return;
-            
-            // Sort the points
-            std::sort(points.begin(), points.end());
-            
-            auto n = points.size() - 1;
-            
-            dx.resize(n);
-            for (auto i = 0; i < n; ++i)
-                dx[i] = points[i + 1].x - points[i].x;
-            
-            alpha.resize(n);
-            for (auto i = 1; i < n; ++i)
-                alpha[i] = 3.0 * (points[i + 1].a - points[i].a) / dx[i] - 3.0 * (points[i].a - points[i - 1].a) / dx[i - 1];
-            
-            l.resize(n + 1);
-            mu.resize(n + 1);
-            z.resize(n + 1);
-            
+
+            auto n = positionData.size() - 1;
+
+            std::vector<float> dx(n);
+            for (std::size_t i = 0; i < n; ++i)
+                dx[i] = positionData[i + 1] - positionData[i];
+
+            std::vector<float> alpha(n);
+            for (std::size_t i = 1; i < n; ++i)
+                alpha[i] = 3.0 * (a[i + 1] - a[i]) / dx[i] - 3.0 * (a[i] - a[i - 1]) / dx[i - 1];
+
+            std::vector<float> l(n + 1), mu(n + 1), z(n + 1);
+
             l[0] = l[n] = 1;
             mu[0] = z[0] = z[n] = 0;
-            
-            for (auto i = 1; i < n; ++i)
+
+            for (std::size_t i = 1; i < n; ++i)
             {
-                l[i] = 2.0 * (points[i + 1].x - points[i - 1].x) - dx[i - 1] * mu[i - 1];
+                l[i] = 2.0 * (positionData[i + 1] - positionData[i - 1]) - dx[i - 1] * mu[i - 1];
                 mu[i] = dx[i] / l[i];
                 z[i] = (alpha[i] - dx[i - 1] * z[i - 1]) / l[i];
             }
-            
-            points[n].c = 0;
-            
+
+            c[n] = 0;
+
             for (int i = int(n - 1); i >= 0; --i)
             {
-                points[i].c = z[i] - mu[i] * points[i + 1].c;
-                points[i].b = (points[i + 1].a - points[i].a) / dx[i] - dx[i] * (points[i + 1].c + 2.0 * points[i].c) / 3.0;
-                points[i].d = (points[i + 1].c - points[i].c) / (3 * dx[i]);
+                c[i] = z[i] - mu[i] * c[i + 1];
+                b[i] = (a[i + 1] - a[i]) / dx[i] - dx[i] * (c[i + 1] + 2.0 * c[i]) / 3.0;
+                d[i] = (c[i + 1] - c[i]) / (3 * dx[i]);
             }
         }
-        
+
     private:
-        //! The points in the spline
-        std::vector<Point> points;
-        
-        //! Utility vectors for recomputation of coefficients
-        std::vector<float> alpha;
-        std::vector<float> dx;
-        std::vector<float> l;
-        std::vector<float> mu;
-        std::vector<float> z;
+        //! The x positions of the points, kept sorted ascending
+        /*! Mutable, because deferred recomputation solves lazily from const reads */
+        mutable std::vector<float, Allocator> positionData;
+
+        //! The polynomial coefficients, one contiguous vector each (a holds the y values)
+        mutable std::vector<float, Allocator> a;
+        mutable std::vector<float, Allocator> b;
+        mutable std::vector<float, Allocator> c;
+        mutable std::vector<float, Allocator> d;
+
+        //! Should emplacing defer recomputation until the next read?
+        bool deferred = false;
+
+        //! Are the coefficients stale because of a deferred emplace?
+        mutable bool dirty = false;
     };
-    
+
+    //! Cubic spline on the default allocator
+    using CubicSpline = BasicCubicSpline<>;
+
+    //! Cubic spline with a compile-time number of control points and no heap allocation
+    /*! Array-backed counterpart of CubicSpline for real-time threads: all storage, including
+        the solver scratch space, lives on the stack. The points are supplied at construction
+        and the coefficients are solved right away.
+
+        @code{cpp}
+        StaticCubicSpline<3> spline({0, 1, 2}, {1, 8, -3});
+
+        cout << spline[1.124] << endl;
+        @endcode */
+    template <std::size_t N>
+    class StaticCubicSpline
+    {
+        static_assert(N >= 2, "a spline needs at least two points");
+
+    public:
+        //! Construct from positions and their values
+        /*! The positions don't have to be sorted; they are put in order on construction */
+        StaticCubicSpline(const std::array<float, N>& x, const std::array<float, N>& y) :
+            x(x),
+            a(y)
+        {
+            sortPoints();
+            recomputeCoefficients();
+        }
+
+        //! Change the y value of one of the points and re-solve
+        /*! @param index The index of the point, in sorted position order */
+        void setY(std::size_t index, float y)
+        {
+            a[index] = y;
+            recomputeCoefficients();
+        }
+
+        //! Access one of the points on the spline
+        /*! @param position The index being a floating-point, the output will automatically be interpolated */
+        float operator[](double position) const
+        {
+            if (position < x.front())
+                return a.front();
+
+            return evaluateSegment(findSegment(position), position);
+        }
+
+        //! Write a range of points on the spline into caller-owned storage
+        /*! Allocation-free counterpart of CubicSpline::span() with the same forward-only
+            segment cursor */
+        template <typename OutputIterator>
+        void span(std::ptrdiff_t offset, OutputIterator first, OutputIterator last) const
+        {
+            auto segment = findSegment(offset);
+            std::ptrdiff_t position = offset;
+            for (auto it = first; it != last; ++it, ++position)
+            {
+                if (position < x.front())
+                {
+                    *it = a.front();
+                    continue;
+                }
+
+                while (segment + 2 < N && x[segment + 1] <= position)
+                    ++segment;
+
+                *it = evaluateSegment(segment, position);
+            }
+        }
+
+        //! The number of points on the spline
+        constexpr std::size_t size() const { return N; }
+
+        //! The x positions of the points, sorted ascending
+        const std::array<float, N>& positions() const { return x; }
+
+        //! The y values of the points, in the same order as positions()
+        const std::array<float, N>& values() const { return a; }
+
+    private:
+        //! Sort the points on their x positions
+        /*! Insertion sort, moving both arrays in lockstep without temporary storage */
+        void sortPoints()
+        {
+            for (std::size_t i = 1; i < N; ++i)
+                for (auto j = i; j > 0 && x[j] < x[j - 1]; --j)
+                {
+                    std::swap(x[j], x[j - 1]);
+                    std::swap(a[j], a[j - 1]);
+                }
+        }
+
+        //! Find the index of the segment containing a position (binary search)
+        std::size_t findSegment(double position) const
+        {
+            auto it = std::upper_bound(x.begin(), x.end(), position);
+
+            // The last point starts no segment of its own; positions beyond it extrapolate the final segment
+            return std::min<std::size_t>(std::max<std::ptrdiff_t>(std::distance(x.begin(), it) - 1, 0), N - 2);
+        }
+
+        //! Evaluate the polynomial of a single segment
+        float evaluateSegment(std::size_t index, double position) const
+        {
+            const float f = position - x[index];
+            const auto f2 = f * f;
+
+            return a[index] + (b[index] * f) + (c[index] * f2) + (d[index] * f * f2);
+        }
+
+        //! Recompute the coefficients, with all scratch space on the stack
+        void recomputeCoefficients()
+        {
+            constexpr auto n = N - 1;
+
+            std::array<float, n> dx;
+            for (std::size_t i = 0; i < n; ++i)
+                dx[i] = x[i + 1] - x[i];
+
+            std::array<float, n> alpha = {};
+            for (std::size_t i = 1; i < n; ++i)
+                alpha[i] = 3.0 * (a[i + 1] - a[i]) / dx[i] - 3.0 * (a[i] - a[i - 1]) / dx[i - 1];
+
+            std::array<float, N> l, mu, z;
+            l[0] = l[n] = 1;
+            mu[0] = z[0] = z[n] = 0;
+
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                l[i] = 2.0 * (x[i + 1] - x[i - 1]) - dx[i - 1] * mu[i - 1];
+                mu[i] = dx[i] / l[i];
+                z[i] = (alpha[i] - dx[i - 1] * z[i - 1]) / l[i];
+            }
+
+            b[n] = c[n] = d[n] = 0;
+
+            for (int i = int(n - 1); i >= 0; --i)
+            {
+                c[i] = z[i] - mu[i] * c[i + 1];
+                b[i] = (a[i + 1] - a[i]) / dx[i] - dx[i] * (c[i + 1] + 2.0 * c[i]) / 3.0;
+                d[i] = (c[i + 1] - c[i]) / (3 * dx[i]);
+            }
+        }
+
+    private:
+        //! The x positions of the points, kept sorted ascending
+        std::array<float, N> x;
+
+        //! The polynomial coefficients, one contiguous array each (a holds the y values)
+        std::array<float, N> a;
+        std::array<float, N> b;
+        std::array<float, N> c;
+        std::array<float, N> d;
+    };
+
     //! Generate the minima spline of a vector
     template <typename T>
     inline static std::vector<T> minimaSpline(const std::vector<T>& x)
     {
         auto min = findLocalMinimaPositions(x.begin(), x.end());
-        
+
         CubicSpline spline;
         spline.emplaceByIndex(min, x);
-        
+
         return spline.span(0, x.size());
     }
-    
+
     //! Generate the maxima spline of a vector
     template <typename T, long N>
     inline static std::vector<T> maximaSpline(std::vector<T> x)
     {
         auto max = findLocalMaximaPositions(x.begin(), x.end());
-        
+
         CubicSpline spline;
         spline.emplaceByIndex(max, x);
-        
+
         return spline.span(0, x.size());
     }
+
+    //! Generate the minima spline of a vector, drawing all memory from a custom allocator
+    /*! The scanned positions, the spline's own storage and the returned span all come from
+        rebound copies of the given allocator, e.g. an ArenaAllocator */
+    template <typename T, typename Allocator, typename = std::enable_if_t<!std::is_integral<Allocator>::value>>
+    inline static std::vector<T, Allocator> minimaSpline(const std::vector<T>& x, const Allocator& allocator)
+    {
+        using SizeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+        std::vector<std::size_t, SizeAllocator> min{SizeAllocator(allocator)};
+        findLocalMinimaPositions(x.begin(), x.end(), min);
+
+        using FloatAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<float>;
+        BasicCubicSpline<FloatAllocator> spline{FloatAllocator(allocator)};
+        spline.emplaceByIndex(min, x);
+
+        return spline.span(0, x.size(), allocator);
+    }
+
+    //! Generate the maxima spline of a vector, drawing all memory from a custom allocator
+    /*! The scanned positions, the spline's own storage and the returned span all come from
+        rebound copies of the given allocator, e.g. an ArenaAllocator */
+    template <typename T, typename Allocator, typename = std::enable_if_t<!std::is_integral<Allocator>::value>>
+    inline static std::vector<T, Allocator> maximaSpline(const std::vector<T>& x, const Allocator& allocator)
+    {
+        using SizeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+        std::vector<std::size_t, SizeAllocator> max{SizeAllocator(allocator)};
+        findLocalMaximaPositions(x.begin(), x.end(), max);
+
+        using FloatAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<float>;
+        BasicCubicSpline<FloatAllocator> spline{FloatAllocator(allocator)};
+        spline.emplaceByIndex(max, x);
+
+        return spline.span(0, x.size(), allocator);
+    }
+
+    //! Generate an envelope spline through scanned extrema, spreading the work over threads
+    /*! Shared implementation of the threaded minimaSpline() and maximaSpline(). Both the
+        extrema scan and the span evaluation run chunked on separate threads; the scan chunks
+        overlap one sample on either side, so every sample still sees both of its neighbors
+        and the output is identical to the single-threaded version. The spline itself is
+        solved once, in between, so the evaluation threads share it read-only. */
+    template <typename T, typename Scan>
+    inline static std::vector<T> envelopeSpline(const std::vector<T>& x, std::size_t threadCount, Scan scan)
+    {
+        // Too little data to win anything? Run everything on one thread
+        if (threadCount < 2 || x.size() < threadCount * 3)
+            threadCount = 1;
+
+        // Scan the chunks for extrema
+        const auto chunkSize = (x.size() + threadCount - 1) / threadCount;
+        std::vector<std::future<std::vector<std::size_t>>> scans;
+        for (std::size_t start = 0; start < x.size(); start += chunkSize)
+        {
+            const auto stop = std::min(start + chunkSize, x.size());
+            scans.emplace_back(std::async(std::launch::async, [&, start, stop]
+            {
+                const auto overlapStart = start > 0 ? start - 1 : 0;
+                auto found = scan(x.begin() + overlapStart, x.begin() + std::min(stop + 1, x.size()));
+
+                // Rebase the positions, dropping those belonging to the neighbouring chunk
+                std::vector<std::size_t> positions;
+                for (auto& position : found)
+                {
+                    const auto global = position + overlapStart;
+                    if (global >= start && global < stop)
+                        positions.emplace_back(global);
+                }
+
+                return positions;
+            }));
+        }
+
+        // Stitch the chunks back together, in order
+        std::vector<std::size_t> positions;
+        for (auto& future : scans)
+        {
+            const auto part = future.get();
+            positions.insert(positions.end(), part.begin(), part.end());
+        }
+
+        // Solve the spline once up front, so the evaluation threads can share it read-only
+        CubicSpline spline;
+        spline.deferRecomputation();
+        spline.emplaceByIndex(positions, x);
+        spline.deferRecomputation(false);
+
+        // Evaluate the span in chunks; the segments are independent once solved
+        std::vector<T> out(x.size());
+        std::vector<std::future<void>> spans;
+        for (std::size_t start = 0; start < x.size(); start += chunkSize)
+        {
+            const auto stop = std::min(start + chunkSize, x.size());
+            spans.emplace_back(std::async(std::launch::async, [&, start, stop]
+            {
+                spline.span(static_cast<std::ptrdiff_t>(start), out.begin() + start, out.begin() + stop);
+            }));
+        }
+
+        for (auto& future : spans)
+            future.get();
+
+        return out;
+    }
+
+    //! Generate the minima spline of a vector, spreading the work over multiple threads
+    /*! Chunked counterpart of minimaSpline() for long signals, producing identical output */
+    template <typename T>
+    inline static std::vector<T> minimaSpline(const std::vector<T>& x, std::size_t threadCount)
+    {
+        return envelopeSpline(x, threadCount, [](auto begin, auto end){ return findLocalMinimaPositions(begin, end); });
+    }
+
+    //! Generate the maxima spline of a vector, spreading the work over multiple threads
+    /*! Chunked counterpart of maximaSpline() for long signals, producing identical output */
+    template <typename T>
+    inline static std::vector<T> maximaSpline(const std::vector<T>& x, std::size_t threadCount)
+    {
+        return envelopeSpline(x, threadCount, [](auto begin, auto end){ return findLocalMaximaPositions(begin, end); });
+    }
 }
 
 #endif
@@ -11,30 +11,263 @@
 
 #include <cmath>
 #include <cstddef>
+#include <iterator>
 #include <numeric>
+#include <stdexcept>
 #include <vector>
 
 namespace math
 {
+    //! Kahan-compensated accumulator
+    /*! Behaves like a single number under += but carries a compensation term for the low-order
+        bits lost in each addition, so long single-precision sums don't drift. Usable as the
+        accumulator policy of mean(), meanSquare() and dot(). */
+    template <typename T>
+    class KahanAccumulator
+    {
+    public:
+        KahanAccumulator() = default;
+        KahanAccumulator(const T& value) : sum(value) { }
+
+        //! Add a value, compensating for the bits the addition loses
+        KahanAccumulator& operator+=(const T& value)
+        {
+            const auto y = value - compensation;
+            const auto t = sum + y;
+            compensation = (t - sum) - y;
+            sum = t;
+
+            return *this;
+        }
+
+        KahanAccumulator operator+(const T& value) const
+        {
+            auto result = *this;
+            result += value;
+
+            return result;
+        }
+
+        //! The accumulated sum
+        operator T() const { return sum; }
+
+    private:
+        //! The compensated sum of the added values
+        T sum = 0;
+
+        //! The running compensation for lost low-order bits
+        T compensation = 0;
+    };
+
     //! Calculate the mean
-    template <typename T, typename Iterator>
+    /*! The optional Accumulator parameter selects the summation precision: mean<float, double>()
+        reads floats at full bandwidth but accumulates in double, and a KahanAccumulator keeps
+        single-precision sums from drifting over long ranges. */
+    template <typename T, typename Accumulator = T, typename Iterator>
     T mean(Iterator begin, Iterator end)
     {
-        return std::accumulate(begin, end, T(0)) / static_cast<T>(std::distance(begin, end));
+        Accumulator sum(0);
+        for (auto it = begin; it != end; ++it)
+            sum += *it;
+
+        return static_cast<T>(sum) / static_cast<T>(std::distance(begin, end));
     }
-    
+
     //! Calculate the mean square
-    template <typename T, typename Iterator>
+    /*! The samples are converted to T before squaring; the optional Accumulator parameter
+        selects the precision the squares are summed in, like with mean() */
+    template <typename T, typename Accumulator = T, typename Iterator>
     T meanSquare(Iterator begin, Iterator end)
     {
-        return std::accumulate(begin, end, T(0), [](const T& accumulatedValue, const T& currentValue) { return accumulatedValue + currentValue * currentValue; }) / static_cast<T>(std::distance(begin, end));
+        Accumulator sum(0);
+        for (auto it = begin; it != end; ++it)
+        {
+            const T value = *it;
+            sum += value * value;
+        }
+
+        return static_cast<T>(sum) / static_cast<T>(std::distance(begin, end));
     }
-    
+
     //! Calculate the root mean square
-    template <typename T, typename Iterator>
+    template <typename T, typename Accumulator = T, typename Iterator>
     T rootMeanSquare(Iterator begin, Iterator end)
     {
-        return std::sqrt(meanSquare<T>(begin, end));
+        return std::sqrt(meanSquare<T, Accumulator>(begin, end));
+    }
+
+    //! Running mean accumulator with O(1) updates
+    /*! Samples can be pushed in and popped out one at a time, so a sliding mean over a long
+        stream costs O(N) instead of re-reading every window. Uses Kahan-compensated summation
+        to keep the accumulator from drifting over hour-long streams. */
+    template <typename T>
+    class RunningMean
+    {
+    public:
+        //! Add a sample to the accumulator
+        void push(const T& sample)
+        {
+            add(sample);
+            ++count;
+        }
+
+        //! Remove a previously pushed sample from the accumulator
+        void pop(const T& sample)
+        {
+            add(-sample);
+            --count;
+        }
+
+        //! The mean of the accumulated samples
+        T mean() const { return static_cast<T>(sum) / static_cast<T>(count); }
+
+        //! The number of accumulated samples
+        std::size_t size() const { return count; }
+
+        //! Reset the accumulator to an empty state
+        void clear() { sum = {}; count = 0; }
+
+    private:
+        //! Add a value to the sum with Kahan compensation
+        void add(const T& value)
+        {
+            sum += value;
+        }
+
+    private:
+        //! The compensated sum of the samples
+        KahanAccumulator<T> sum;
+
+        //! The number of accumulated samples
+        std::size_t count = 0;
+    };
+
+    //! Running mean square accumulator with O(1) updates
+    /*! The squared counterpart of RunningMean, for sliding RMS metering and AGC */
+    template <typename T>
+    class RunningMeanSquare
+    {
+    public:
+        //! Add a sample to the accumulator
+        void push(const T& sample) { squares.push(sample * sample); }
+
+        //! Remove a previously pushed sample from the accumulator
+        void pop(const T& sample) { squares.pop(sample * sample); }
+
+        //! The mean square of the accumulated samples
+        T meanSquare() const { return squares.mean(); }
+
+        //! The root mean square of the accumulated samples
+        T rootMeanSquare() const { return std::sqrt(meanSquare()); }
+
+        //! The number of accumulated samples
+        std::size_t size() const { return squares.size(); }
+
+        //! Reset the accumulator to an empty state
+        void clear() { squares.clear(); }
+
+    private:
+        //! The running mean over the squared samples
+        RunningMean<T> squares;
+    };
+
+    //! Mean square over a sliding window of the most recent samples
+    /*! Remembers the samples in a ring buffer, so each push() pops the expired sample
+        automatically once the window is full */
+    template <typename T>
+    class WindowedMeanSquare
+    {
+    public:
+        //! Construct with a given window size
+        /*! @throw std::invalid_argument if the window size is zero */
+        WindowedMeanSquare(std::size_t windowSize) : window(windowSize)
+        {
+            if (windowSize == 0)
+                throw std::invalid_argument("window size == 0");
+        }
+
+        //! Push the next sample, expiring the oldest one when the window is full
+        void push(const T& sample)
+        {
+            if (running.size() == window.size())
+                running.pop(window[index]);
+
+            running.push(sample);
+            window[index] = sample;
+            index = (index + 1) % window.size();
+        }
+
+        //! The mean square over the window
+        T meanSquare() const { return running.meanSquare(); }
+
+        //! The root mean square over the window
+        T rootMeanSquare() const { return running.rootMeanSquare(); }
+
+        //! The number of samples currently in the window
+        std::size_t size() const { return running.size(); }
+
+    private:
+        //! The samples currently in the window
+        std::vector<T> window;
+
+        //! The accumulator over the window
+        RunningMeanSquare<T> running;
+
+        //! The write position in the ring buffer
+        std::size_t index = 0;
+    };
+
+    //! Summary statistics of a range, computed in a single pass by summarize()
+    template <typename T>
+    struct Summary
+    {
+        T mean = 0; //!< The mean
+        T meanSquare = 0; //!< The mean square
+        T rootMeanSquare = 0; //!< The root mean square
+        T minimum = 0; //!< The smallest value
+        T maximum = 0; //!< The biggest value
+        std::size_t peakPosition = 0; //!< The position of the first absolute peak
+    };
+
+    //! Summarize a range in a single fused pass
+    /*! Computes mean, mean square, root mean square, extrema and peak position while reading
+        the range only once, where calling the individual functions would sweep it per statistic.
+     @warning If begin == end, the result is undefined */
+    template <typename T, typename Iterator>
+    Summary<T> summarize(Iterator begin, Iterator end)
+    {
+        Summary<T> summary;
+
+        T sum = 0;
+        T sumSquares = 0;
+        T peak = std::abs(static_cast<T>(*begin));
+        summary.minimum = summary.maximum = static_cast<T>(*begin);
+
+        std::size_t position = 0;
+        for (auto it = begin; it != end; ++it, ++position)
+        {
+            const T value = *it;
+            sum += value;
+            sumSquares += value * value;
+
+            if (value < summary.minimum)
+                summary.minimum = value;
+
+            if (value > summary.maximum)
+                summary.maximum = value;
+
+            if (std::abs(value) > peak)
+            {
+                peak = std::abs(value);
+                summary.peakPosition = position;
+            }
+        }
+
+        summary.mean = sum / static_cast<T>(position);
+        summary.meanSquare = sumSquares / static_cast<T>(position);
+        summary.rootMeanSquare = std::sqrt(summary.meanSquare);
+
+        return summary;
     }
 }
 
@@ -0,0 +1,95 @@
+//
+//  table.hpp
+//  Math
+//
+//  Copyright © 2015-2016 Dsperados (info@dsperados.com). All rights reserved.
+//  Licensed under the BSD 3-clause license.
+//
+
+#ifndef DSPERADOS_MATH_TABLE_HPP
+#define DSPERADOS_MATH_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace math
+{
+    //! Lookup table caching an expensive function over an interval
+    /*! Samples the function at N equidistant points on construction — at compile time when the
+        function itself is constexpr — and afterwards approximates calls by interpolating
+        linearly between the cached samples. Useful for pulling sigmoids and easing curves out
+        of per-sample paths.
+
+        @code{cpp}
+        LookupTable<float, 512> table([](double x){ return sigmoid(x, 2.0, 2.0); }, -1, 1);
+
+        cout << table(0.3) << endl;
+        @endcode */
+    template <typename T, std::size_t N>
+    class LookupTable
+    {
+        static_assert(N >= 2, "a lookup table needs at least two samples");
+
+    public:
+        //! Fill the table by sampling a function over [min, max]
+        template <typename Function>
+        constexpr LookupTable(Function function, double min, double max) :
+            min(min),
+            max(max),
+            factor((N - 1) / (max - min))
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                table[i] = function(min + i / factor);
+        }
+
+        //! Look up a value, interpolating linearly between the cached samples
+        /*! Arguments outside [min, max] are clamped onto the interval */
+        constexpr T operator()(double x) const
+        {
+            if (x <= min)
+                return table[0];
+
+            if (x >= max)
+                return table[N - 1];
+
+            const auto position = (x - min) * factor;
+
+            // The multiplication can round up to exactly N - 1 for x just below max;
+            // clamp so index + 1 stays within the table
+            const auto index = std::min(static_cast<std::size_t>(position), N - 2);
+            const auto fraction = position - index;
+
+            return table[index] + fraction * (table[index + 1] - table[index]);
+        }
+
+        //! Look up a whole buffer of values
+        /*! Applies the table to every element of the input range, for pulling the lookup out of
+            a caller's per-sample loop */
+        template <typename InputIterator, typename OutputIterator>
+        void process(InputIterator begin, InputIterator end, OutputIterator outBegin) const
+        {
+            std::transform(begin, end, outBegin, [&](const auto& x){ return (*this)(x); });
+        }
+
+        //! The number of cached samples
+        constexpr std::size_t size() const { return N; }
+
+        // Return iterators for ranged for-loops over the cached samples
+        constexpr auto begin() const { return table.begin(); }
+        constexpr auto end() const { return table.end(); }
+
+    private:
+        //! The cached samples
+        std::array<T, N> table = {};
+
+        //! The interval the function was sampled over
+        double min = 0;
+        double max = 1;
+
+        //! Samples per unit of x
+        double factor = 1;
+    };
+}
+
+#endif
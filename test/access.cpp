@@ -0,0 +1,63 @@
+#include <stdexcept>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../access.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("access")
+{
+    vector<float> x = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    SUBCASE("ThrowAccess throws out of range")
+    {
+        CHECK(access(x.begin(), x.end(), 3) == doctest::Approx(4));
+        CHECK_THROWS_AS(access(x.begin(), x.end(), -1), std::out_of_range);
+        CHECK_THROWS_AS(access(x.begin(), x.end(), 8), std::out_of_range);
+    }
+
+    SUBCASE("the fast clamped and wrapped accessors match the originals")
+    {
+        for (ptrdiff_t index = -20; index < 20; ++index)
+        {
+            CHECK(access(x.begin(), x.end(), index, FastClampedAccess()) == access(x.begin(), x.end(), index, ClampedAccess()));
+            CHECK(access(x.begin(), x.end(), index, FastWrappedAccess()) == access(x.begin(), x.end(), index, WrappedAccess()));
+        }
+    }
+
+    SUBCASE("the size-caching accessors match the originals")
+    {
+        CachedClampedAccess clamped(x.size());
+        CachedWrappedAccess wrapped(x.size());
+
+        for (ptrdiff_t index = -20; index < 20; ++index)
+        {
+            CHECK(access(x.begin(), x.end(), index, clamped) == access(x.begin(), x.end(), index, ClampedAccess()));
+            CHECK(access(x.begin(), x.end(), index, wrapped) == access(x.begin(), x.end(), index, WrappedAccess()));
+        }
+    }
+
+    SUBCASE("MaskedWrappedAccess")
+    {
+        SUBCASE("matches WrappedAccess for a power-of-two size")
+        {
+            MaskedWrappedAccess masked(x.size());
+            for (ptrdiff_t index = -20; index < 20; ++index)
+                CHECK(access(x.begin(), x.end(), index, masked) == access(x.begin(), x.end(), index, WrappedAccess()));
+        }
+
+        SUBCASE("rejects other sizes")
+        {
+            CHECK_THROWS_AS(MaskedWrappedAccess(6), std::invalid_argument);
+        }
+    }
+
+    SUBCASE("FastMirroredAccess matches MirroredAccess")
+    {
+        for (ptrdiff_t index = -20; index < 20; ++index)
+            CHECK(access(x.begin(), x.end(), index, FastMirroredAccess()) == access(x.begin(), x.end(), index, MirroredAccess()));
+    }
+}
@@ -0,0 +1,70 @@
+#include <vector>
+
+#include "doctest.h"
+
+#include "../allocator.hpp"
+#include "../sinusoid.hpp"
+#include "../spline.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("Arena")
+{
+    char memory[8192];
+    Arena arena(memory, sizeof(memory));
+
+    SUBCASE("allocations stay within the provided memory")
+    {
+        ArenaAllocator<float> allocator(arena);
+        auto buffer = generateSineBuffer<float>(512, allocator);
+
+        CHECK(buffer.size() == 512);
+        CHECK(reinterpret_cast<char*>(buffer.data()) >= memory);
+        CHECK(reinterpret_cast<char*>(buffer.data() + buffer.size()) <= memory + sizeof(memory));
+        CHECK(arena.used() >= 512 * sizeof(float));
+    }
+
+    SUBCASE("allocations from an unaligned buffer are still aligned")
+    {
+        // Start the arena one byte into the buffer, so offset 0 is misaligned
+        Arena unaligned(memory + 1, sizeof(memory) - 1);
+
+        for (auto i = 0; i < 4; ++i)
+        {
+            const auto pointer = unaligned.allocate(sizeof(double) + 1, alignof(double));
+            REQUIRE(pointer != nullptr);
+            CHECK(reinterpret_cast<uintptr_t>(pointer) % alignof(double) == 0);
+        }
+    }
+
+    SUBCASE("clear() reclaims all memory at once")
+    {
+        arena.allocate(1024, 4);
+        CHECK(arena.used() >= 1024);
+
+        arena.clear();
+        CHECK(arena.used() == 0);
+    }
+
+    SUBCASE("a whole spline can live in the arena")
+    {
+        vector<float> x = {1, 0, 2, 0, 3, -1, 0.5, 0.1, 0.4, 0};
+
+        const auto fromHeap = minimaSpline<float>(x);
+        const auto fromArena = minimaSpline(x, ArenaAllocator<float>(arena));
+
+        CHECK(arena.used() > 0);
+        REQUIRE(fromArena.size() == fromHeap.size());
+        for (size_t i = 0; i < fromHeap.size(); ++i)
+            CHECK(fromArena[i] == doctest::Approx(fromHeap[i]));
+
+        CHECK(reinterpret_cast<const char*>(fromArena.data()) >= memory);
+        CHECK(reinterpret_cast<const char*>(fromArena.data() + fromArena.size()) <= memory + sizeof(memory));
+    }
+
+    SUBCASE("running out of memory returns null")
+    {
+        CHECK(arena.allocate(sizeof(memory) + 1, 4) == nullptr);
+    }
+}
@@ -0,0 +1,73 @@
+#include <utility>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../analysis.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("analysis")
+{
+    vector<float> x = {1, 0, 2, 0, 3, -1, 0.5};
+
+    SUBCASE("findLocalMinimaPositions() and findLocalMaximaPositions()")
+    {
+        const vector<size_t> minima = {1, 3, 5};
+        const vector<size_t> maxima = {2, 4};
+
+        CHECK(findLocalMinimaPositions(x.begin(), x.end()) == minima);
+        CHECK(findLocalMaximaPositions(x.begin(), x.end()) == maxima);
+
+        SUBCASE("the last element never counts as an extremum")
+        {
+            vector<float> descending = {5, 4, 3, 2, 1};
+            CHECK(findLocalMinimaPositions(descending.begin(), descending.end()).empty());
+
+            vector<float> ascending = {1, 2, 3, 4, 5};
+            CHECK(findLocalMaximaPositions(ascending.begin(), ascending.end()).empty());
+        }
+    }
+
+    SUBCASE("the value-carrying scanners agree with the position scanners")
+    {
+        vector<pair<size_t, float>> minima, maxima;
+        findLocalMinima(x.begin(), x.end(), minima);
+        findLocalMaxima(x.begin(), x.end(), maxima);
+
+        const auto minimaPositions = findLocalMinimaPositions(x.begin(), x.end());
+        REQUIRE(minima.size() == minimaPositions.size());
+        for (size_t i = 0; i < minima.size(); ++i)
+        {
+            CHECK(minima[i].first == minimaPositions[i]);
+            CHECK(minima[i].second == doctest::Approx(x[minimaPositions[i]]));
+        }
+
+        const auto maximaPositions = findLocalMaximaPositions(x.begin(), x.end());
+        REQUIRE(maxima.size() == maximaPositions.size());
+        for (size_t i = 0; i < maxima.size(); ++i)
+        {
+            CHECK(maxima[i].first == maximaPositions[i]);
+            CHECK(maxima[i].second == doctest::Approx(x[maximaPositions[i]]));
+        }
+    }
+
+    SUBCASE("findLocalExtremaPositions() matches the two separate sweeps")
+    {
+        const auto extrema = findLocalExtremaPositions(x.begin(), x.end());
+
+        CHECK(extrema.first == findLocalMinimaPositions(x.begin(), x.end()));
+        CHECK(extrema.second == findLocalMaximaPositions(x.begin(), x.end()));
+    }
+
+    SUBCASE("countZeroCrossings()")
+    {
+        CHECK(countZeroCrossings(x.begin(), x.end()) == 2);
+    }
+
+    SUBCASE("findAbsolutePeak()")
+    {
+        CHECK(findAbsolutePeak(x.begin(), x.end()) == doctest::Approx(3));
+    }
+}
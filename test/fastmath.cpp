@@ -0,0 +1,72 @@
+#include <cmath>
+
+#include "doctest.h"
+
+#include "../fastmath.hpp"
+#include "../sigmoid.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("fastmath")
+{
+    SUBCASE("sin() and cos() track the standard library")
+    {
+        for (double x = -20; x < 20; x += 0.01)
+        {
+            CHECK(fast::sin(x) == doctest::Approx(sin(x)).epsilon(1e-6));
+            CHECK(fast::cos(x) == doctest::Approx(cos(x)).epsilon(1e-6));
+        }
+    }
+
+    SUBCASE("exp() tracks the standard library")
+    {
+        for (double x = -20; x < 20; x += 0.01)
+            CHECK(fast::exp(x) == doctest::Approx(exp(x)).epsilon(1e-6));
+    }
+
+    SUBCASE("exp() saturates instead of wrapping the exponent bits")
+    {
+        CHECK(fast::exp(-746.0) == 0);
+        CHECK(fast::exp(-10000.0) == 0);
+        CHECK(isinf(fast::exp(710.0)));
+        CHECK(isinf(fast::exp(10000.0)));
+    }
+
+    SUBCASE("atan() tracks the standard library")
+    {
+        for (double x = -50; x < 50; x += 0.01)
+            CHECK(fast::atan(x) == doctest::Approx(atan(x)).epsilon(1e-5));
+    }
+
+    SUBCASE("atan2() respects the quadrant")
+    {
+        for (double y = -3; y <= 3; y += 0.5)
+            for (double x = -3; x <= 3; x += 0.5)
+                CHECK(fast::atan2(y, x) == doctest::Approx(atan2(y, x)).epsilon(1e-5));
+    }
+
+    SUBCASE("tanh() tracks the standard library")
+    {
+        for (double x = -12; x < 12; x += 0.01)
+            CHECK(fast::tanh(x) == doctest::Approx(tanh(x)).epsilon(1e-5));
+    }
+
+    SUBCASE("the sigmoid functors accept the fast policy")
+    {
+        SigmoidTan<float, fast::Transcendentals> fastTan(2, 3);
+        SigmoidExp<float, fast::Transcendentals> fastExp(2, 3);
+
+        for (double x = -1; x <= 1; x += 0.125)
+        {
+            CHECK(fastTan(x) == doctest::Approx(sigmoidTan(x, 2, 3)).epsilon(1e-5));
+            CHECK(fastExp(x) == doctest::Approx(sigmoidExp(x, 2, 3)).epsilon(1e-5));
+        }
+
+        SUBCASE("a large transient saturates instead of exploding")
+        {
+            CHECK(fastExp(1000.f) == doctest::Approx(sigmoidExp(1000.f, 2, 3)));
+            CHECK(fastExp(-1000.f) == doctest::Approx(sigmoidExp(-1000.f, 2, 3)));
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#include <array>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../interleave.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("interleave")
+{
+    vector<float> left = {1, 2, 3, 4};
+    vector<float> right = {5, 6, 7, 8};
+    const vector<float> interleaved = {1, 5, 2, 6, 3, 7, 4, 8};
+
+    SUBCASE("two ranges round-trip")
+    {
+        vector<float> mixed(8);
+        interleave(left.begin(), left.end(), right.begin(), mixed.begin());
+        CHECK(mixed == interleaved);
+
+        vector<float> outLeft(4), outRight(4);
+        deinterleave(mixed.begin(), mixed.end(), outLeft.begin(), outRight.begin());
+        CHECK(outLeft == left);
+        CHECK(outRight == right);
+    }
+
+    SUBCASE("a runtime number of channels round-trips")
+    {
+        vector<float> third = {9, 10, 11, 12};
+        vector<vector<float>::iterator> channels = {left.begin(), right.begin(), third.begin()};
+
+        vector<float> mixed(12);
+        interleave(channels, 4, mixed.begin());
+
+        const vector<float> expected = {1, 5, 9, 2, 6, 10, 3, 7, 11, 4, 8, 12};
+        CHECK(mixed == expected);
+
+        vector<float> outLeft(4), outRight(4), outThird(4);
+        vector<vector<float>::iterator> outChannels = {outLeft.begin(), outRight.begin(), outThird.begin()};
+        deinterleave(mixed.begin(), mixed.end(), outChannels);
+
+        CHECK(outLeft == left);
+        CHECK(outRight == right);
+        CHECK(outThird == third);
+    }
+
+    SUBCASE("a compile-time number of contiguous channels round-trips")
+    {
+        array<const float*, 2> channels = {left.data(), right.data()};
+
+        vector<float> mixed(8);
+        interleave(channels, 4, mixed.data());
+        CHECK(mixed == interleaved);
+
+        vector<float> outLeft(4), outRight(4);
+        array<float*, 2> outChannels = {outLeft.data(), outRight.data()};
+        deinterleave(mixed.data(), 4, outChannels);
+
+        CHECK(outLeft == left);
+        CHECK(outRight == right);
+    }
+}
@@ -0,0 +1,80 @@
+#include <vector>
+
+#include "doctest.h"
+
+#include "../interpolation.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("interpolate")
+{
+    vector<float> x = {0, 1, 2, 3};
+
+    SUBCASE("single index")
+    {
+        CHECK(interpolate(x.begin(), x.end(), 1.5) == doctest::Approx(1.5));
+        CHECK(interpolate(x.begin(), x.end(), 1.25, CatmullRomInterpolation()) == doctest::Approx(1.25));
+    }
+
+    SUBCASE("batch")
+    {
+        vector<double> indices = {0.0, 0.5, 1.5, 2.5, 3.5};
+        vector<float> out(indices.size());
+
+        SUBCASE("matches the single-sample calls")
+        {
+            interpolate(x.begin(), x.end(), indices.begin(), indices.end(), out.begin());
+
+            for (auto i = 0; i < indices.size(); ++i)
+                CHECK(out[i] == doctest::Approx(interpolate(x.begin(), x.end(), indices[i])));
+        }
+
+        SUBCASE("matches the single-sample calls for a four-point stencil")
+        {
+            interpolate(x.begin(), x.end(), indices.begin(), indices.end(), out.begin(), CatmullRomInterpolation());
+
+            for (auto i = 0; i < indices.size(); ++i)
+                CHECK(out[i] == doctest::Approx(interpolate(x.begin(), x.end(), indices[i], CatmullRomInterpolation())));
+        }
+
+        SUBCASE("returns one past the last written sample")
+        {
+            auto it = interpolate(x.begin(), x.end(), indices.begin(), indices.end(), out.begin());
+            CHECK(it == out.end());
+        }
+    }
+
+    SUBCASE("SlidingInterpolator")
+    {
+        vector<float> table = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+
+        SUBCASE("matches interpolate() over a monotonic sweep")
+        {
+            SlidingInterpolator<vector<float>::iterator, CatmullRomInterpolation> sliding(table.begin(), table.end());
+
+            for (double index = -1; index < 11; index += 0.3)
+                CHECK(sliding(index) == doctest::Approx(interpolate(table.begin(), table.end(), index, CatmullRomInterpolation())));
+        }
+
+        SUBCASE("repeated and jumping indices give the same results")
+        {
+            SlidingInterpolator<vector<float>::iterator, CubicInterpolation> sliding(table.begin(), table.end());
+
+            vector<double> indices = {2.5, 2.5, 2.75, 8.25, 1.5, 9.5};
+            for (auto& index : indices)
+                CHECK(sliding(index) == doctest::Approx(interpolate(table.begin(), table.end(), index, CubicInterpolation())));
+        }
+
+        SUBCASE("reset() refetches after the data changed")
+        {
+            SlidingInterpolator<vector<float>::iterator> sliding(table.begin(), table.end());
+            sliding(4.5);
+
+            table[5] = -7;
+            sliding.reset();
+
+            CHECK(sliding(4.5) == doctest::Approx(interpolate(table.begin(), table.end(), 4.5)));
+        }
+    }
+}
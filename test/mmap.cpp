@@ -0,0 +1,59 @@
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../analysis.hpp"
+#include "../mmap.hpp"
+#include "../statistics.hpp"
+
+using namespace math;
+using namespace std;
+
+#if __has_include(<sys/mman.h>)
+
+TEST_CASE("MemoryMappedFile")
+{
+    const string path = "/tmp/math-test-mapped.bin";
+
+    vector<float> x = {1, -4, 3, 2, -1, 0.5};
+    {
+        ofstream file(path, ios::binary);
+        file.write(reinterpret_cast<const char*>(x.data()), x.size() * sizeof(float));
+    }
+
+    MemoryMappedFile<float> mapped(path);
+
+    SUBCASE("exposes the file as a range of samples")
+    {
+        REQUIRE(mapped.size() == x.size());
+        for (size_t i = 0; i < x.size(); ++i)
+            CHECK(mapped[i] == doctest::Approx(x[i]));
+    }
+
+    SUBCASE("the analysis algorithms run on the mapping directly")
+    {
+        CHECK(mean<float>(mapped.begin(), mapped.end()) == doctest::Approx(mean<float>(x.begin(), x.end())));
+        CHECK(countZeroCrossings(mapped.begin(), mapped.end()) == countZeroCrossings(x.begin(), x.end()));
+        CHECK(findLocalMinimaPositions(mapped.begin(), mapped.end()) == findLocalMinimaPositions(x.begin(), x.end()));
+    }
+
+    SUBCASE("self-move-assignment keeps the mapping alive")
+    {
+        auto& self = mapped;
+        mapped = std::move(self);
+
+        REQUIRE(mapped.size() == x.size());
+        CHECK(mapped[0] == doctest::Approx(x[0]));
+    }
+
+    SUBCASE("throws for a file that doesn't exist")
+    {
+        CHECK_THROWS_AS(MemoryMappedFile<float>("/tmp/math-test-missing.bin"), std::runtime_error);
+    }
+
+    remove(path.c_str());
+}
+
+#endif
@@ -56,6 +56,40 @@ TEST_CASE("normalize")
         }
     }
     
+    SUBCASE("normalize() across multiple tiles")
+    {
+        // Put the peak in the last tile, so every earlier tile needs the correction pass
+        vector<float> x(10000);
+        for (size_t i = 0; i < x.size(); ++i)
+            x[i] = 0.1f * (i % 7) - 0.3f;
+        x[9000] = -2;
+
+        vector<float> out(x.size());
+        normalize(x.begin(), x.end(), out.begin());
+
+        for (size_t i = 0; i < x.size(); ++i)
+            REQUIRE(out[i] == doctest::Approx(x[i] / 2));
+    }
+
+    SUBCASE("in-place normalize()")
+    {
+        vector<float> x = {0.1, -0.5, 0.25};
+        vector<float> expected(x.size());
+        normalize(x.begin(), x.end(), expected.begin());
+
+        normalize(x.begin(), x.end());
+        CHECK(x == expected);
+
+        SUBCASE("an almost normalized signal is left untouched")
+        {
+            vector<float> nearlyFlat = {0.3f, -0.995f, 0.1f};
+            const auto copy = nearlyFlat;
+
+            normalize(nearlyFlat.begin(), nearlyFlat.end(), 0.01);
+            CHECK(nearlyFlat == copy);
+        }
+    }
+
     SUBCASE("normalizeArea()")
     {
         SUBCASE("Area equal to one")
@@ -74,6 +108,45 @@ TEST_CASE("normalize")
             CHECK_THROWS_AS(normalizeArea(x.begin(), x.end(), x.begin()), std::runtime_error);
         }
     }
-    
-    
+
+    SUBCASE("normalizeChannels()")
+    {
+        SUBCASE("each channel is scaled by its own peak")
+        {
+            vector<float> interleaved = {0.1, -0.2, -0.5, 0.1, 0.25, 0.4};
+            normalizeChannels(interleaved.begin(), interleaved.end(), interleaved.begin(), 2);
+
+            vector<float> left = {0.1, -0.5, 0.25};
+            vector<float> right = {-0.2, 0.1, 0.4};
+            normalize(left.begin(), left.end(), left.begin());
+            normalize(right.begin(), right.end(), right.begin());
+
+            for (auto i = 0; i < 3; ++i)
+            {
+                CHECK(interleaved[i * 2] == doctest::Approx(left[i]));
+                CHECK(interleaved[i * 2 + 1] == doctest::Approx(right[i]));
+            }
+        }
+    }
+
+    SUBCASE("normalizeAreaChannels()")
+    {
+        SUBCASE("every channel integrates to one")
+        {
+            vector<float> interleaved = {0.5, 2, 1, 1, 0.5, 3};
+            normalizeAreaChannels(interleaved.begin(), interleaved.end(), interleaved.begin(), 2);
+
+            auto left = interleaved[0] + interleaved[2] + interleaved[4];
+            auto right = interleaved[1] + interleaved[3] + interleaved[5];
+
+            CHECK(left == doctest::Approx(1.f));
+            CHECK(right == doctest::Approx(1.f));
+        }
+
+        SUBCASE("throws when one channel has an integral of zero")
+        {
+            vector<float> interleaved = {1, 1, -1, 1};
+            CHECK_THROWS_AS(normalizeAreaChannels(interleaved.begin(), interleaved.end(), interleaved.begin(), 2), std::runtime_error);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <cmath>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../analysis.hpp"
+#include "../normalize.hpp"
+#include "../parallel.hpp"
+#include "../statistics.hpp"
+
+#if __has_include(<execution>)
+#ifdef __cpp_lib_execution
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("parallel")
+{
+    vector<float> x(10000);
+    for (size_t i = 0; i < x.size(); ++i)
+        x[i] = sin(i * 0.37) * cos(i * 0.05) + 0.1;
+
+    SUBCASE("the statistics match the serial versions")
+    {
+        CHECK(mean<float>(execution::par, x.begin(), x.end()) == doctest::Approx(mean<float>(x.begin(), x.end())));
+        CHECK(meanSquare<float>(execution::par, x.begin(), x.end()) == doctest::Approx(meanSquare<float>(x.begin(), x.end())));
+        CHECK(rootMeanSquare<float>(execution::seq, x.begin(), x.end()) == doctest::Approx(rootMeanSquare<float>(x.begin(), x.end())));
+    }
+
+    SUBCASE("normalize() accepts raw-pointer iterators")
+    {
+        vector<float> out(x.size()), reference(x.size());
+        normalize(execution::par, x.data(), x.data() + x.size(), out.data());
+        normalize(x.begin(), x.end(), reference.begin());
+
+        for (size_t i = 0; i < x.size(); ++i)
+            CHECK(out[i] == doctest::Approx(reference[i]));
+    }
+
+    SUBCASE("normalizeArea() matches the serial version")
+    {
+        vector<float> out(x.size()), reference(x.size());
+        normalizeArea(execution::par, x.data(), x.data() + x.size(), out.data());
+        normalizeArea(x.begin(), x.end(), reference.begin());
+
+        for (size_t i = 0; i < x.size(); ++i)
+            CHECK(out[i] == doctest::Approx(reference[i]));
+    }
+
+    SUBCASE("the extrema scanners match the serial scan")
+    {
+        CHECK(findLocalMinimaPositions(execution::par, x.begin(), x.end()) == findLocalMinimaPositions(x.begin(), x.end()));
+        CHECK(findLocalMaximaPositions(execution::par, x.begin(), x.end()) == findLocalMaximaPositions(x.begin(), x.end()));
+        CHECK(findLocalMinimaPositions(execution::seq, x.begin(), x.end()) == findLocalMinimaPositions(x.begin(), x.end()));
+    }
+
+    SUBCASE("countZeroCrossings() matches the serial count")
+    {
+        CHECK(countZeroCrossings(execution::par, x.begin(), x.end()) == countZeroCrossings(x.begin(), x.end()));
+    }
+
+    SUBCASE("interleave() and deinterleave() round-trip")
+    {
+        vector<float> left(1000), right(1000);
+        for (size_t i = 0; i < left.size(); ++i)
+        {
+            left[i] = i * 0.5f;
+            right[i] = -1.f * i;
+        }
+
+        vector<vector<float>::iterator> channels = {left.begin(), right.begin()};
+        vector<float> mixed(2000), reference(2000);
+        interleave(execution::par, channels, 1000, mixed.begin());
+        interleave(channels, 1000, reference.begin());
+        CHECK(mixed == reference);
+
+        vector<float> outLeft(1000), outRight(1000);
+        vector<vector<float>::iterator> outChannels = {outLeft.begin(), outRight.begin()};
+        deinterleave(execution::par, mixed.begin(), mixed.end(), outChannels);
+        CHECK(outLeft == left);
+        CHECK(outRight == right);
+    }
+}
+
+#endif
+#endif
@@ -0,0 +1,49 @@
+#include <vector>
+
+#include "doctest.h"
+
+#include "../random.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("random")
+{
+    SUBCASE("generateUniformRandomBuffer() stays within bounds")
+    {
+        mt19937 engine(0);
+        auto buffer = generateUniformRandomBuffer<float>(128, -1, 1, engine);
+
+        for (auto& sample : buffer)
+        {
+            CHECK(sample >= -1);
+            CHECK(sample <= 1);
+        }
+    }
+
+    SUBCASE("Xorshift64Engine never emits zero and is deterministic")
+    {
+        Xorshift64Engine engine1(42), engine2(42);
+
+        for (auto i = 0; i < 1000; ++i)
+        {
+            auto value = engine1();
+            CHECK(value != 0);
+            CHECK(value == engine2());
+        }
+    }
+
+    SUBCASE("UniformRandomGenerator fills blocks within bounds")
+    {
+        UniformRandomGenerator<float, Xorshift64Engine> noise(-1, 1);
+
+        vector<float> block(128);
+        noise.generate(block.begin(), block.end());
+
+        for (auto& sample : block)
+        {
+            CHECK(sample >= -1);
+            CHECK(sample <= 1);
+        }
+    }
+}
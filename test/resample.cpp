@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../resample.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("Resampler")
+{
+    vector<float> in = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    SUBCASE("matches interpolate() at the accumulated positions")
+    {
+        Resampler<> resampler(0.75);
+
+        vector<float> out(8);
+        resampler.process(in.begin(), in.end(), out.begin(), out.end());
+
+        for (auto i = 0; i < 8; ++i)
+            CHECK(out[i] == doctest::Approx(interpolate(in.begin(), in.end(), i * 0.75)));
+    }
+
+    SUBCASE("stream() is independent of the block size")
+    {
+        vector<float> signal(64);
+        for (size_t i = 0; i < signal.size(); ++i)
+            signal[i] = sin(i * 0.1f);
+
+        // Stream the signal in blocks of a given size and gather the output
+        const auto streamInBlocks = [&](size_t blockSize)
+        {
+            Resampler<CubicInterpolation> resampler(0.75);
+
+            vector<float> out;
+            for (size_t start = 0; start < signal.size(); start += blockSize)
+            {
+                const auto stop = min(start + blockSize, signal.size());
+                resampler.stream(signal.begin() + start, signal.begin() + stop, back_inserter(out));
+            }
+
+            return out;
+        };
+
+        const auto wholeSignal = streamInBlocks(signal.size());
+        CHECK(streamInBlocks(7) == wholeSignal);
+        CHECK(streamInBlocks(1) == wholeSignal);
+
+        SUBCASE("and matches a prefix of process()")
+        {
+            Resampler<CubicInterpolation> resampler(0.75);
+
+            vector<float> processed(wholeSignal.size());
+            resampler.process(signal.begin(), signal.end(), processed.begin(), processed.end());
+
+            REQUIRE(!wholeSignal.empty());
+            for (size_t i = 0; i < wholeSignal.size(); ++i)
+                CHECK(wholeSignal[i] == doctest::Approx(processed[i]));
+        }
+    }
+
+    SUBCASE("phase continues across blocks")
+    {
+        Resampler<> resampler(0.75);
+
+        vector<float> block1(4), block2(4);
+        resampler.process(in.begin(), in.end(), block1.begin(), block1.end());
+        resampler.process(in.begin(), in.end(), block2.begin(), block2.end());
+
+        for (auto i = 0; i < 4; ++i)
+            CHECK(block2[i] == doctest::Approx(interpolate(in.begin(), in.end(), (4 + i) * 0.75)));
+    }
+}
@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <vector>
 
 #include "doctest.h"
 
@@ -30,10 +31,47 @@ TEST_CASE("WaveShaper")
         CHECK(sigmoidExp(1, 1, 1) == doctest::Approx(1));
     }
     
+    SUBCASE("function objects match the free functions")
+    {
+        Sigmoid<double> s(2, 3);
+        SigmoidTan<double> t(2, 3);
+        SigmoidExp<double> e(2, 3);
+
+        for (double x = -1; x <= 1; x += 0.25)
+        {
+            CHECK(s(x) == doctest::Approx(sigmoid(x, 2, 3)));
+            CHECK(t(x) == doctest::Approx(sigmoidTan(x, 2, 3)));
+            CHECK(e(x) == doctest::Approx(sigmoidExp(x, 2, 3)));
+        }
+    }
+
+    SUBCASE("process() matches per-sample calls")
+    {
+        Sigmoid<double> s(2, 3);
+        SigmoidTan<double> t(2, 3);
+        SigmoidExp<double> e(2, 3);
+
+        const vector<double> in = {-1, -0.5, 0, 0.25, 1};
+        vector<double> out(in.size());
+
+        s.process(in.begin(), in.end(), out.begin());
+        for (size_t i = 0; i < in.size(); ++i)
+            CHECK(out[i] == doctest::Approx(s(in[i])));
+
+        t.process(in.begin(), in.end(), out.begin());
+        for (size_t i = 0; i < in.size(); ++i)
+            CHECK(out[i] == doctest::Approx(t(in[i])));
+
+        e.process(in.begin(), in.end(), out.begin());
+        for (size_t i = 0; i < in.size(); ++i)
+            CHECK(out[i] == doctest::Approx(e(in[i])));
+    }
+
     SUBCASE("throw for distortion factor <= 0")
     {
         CHECK_THROWS_AS(sigmoid(0, 0, 0), std::runtime_error);
         CHECK_THROWS_AS(sigmoidTan(0, 0, 0), std::runtime_error);
         CHECK_THROWS_AS(sigmoidExp(0, 0, 0), std::runtime_error);
+        CHECK_THROWS_AS(Sigmoid<double>(0, 0), std::runtime_error);
     }
 }
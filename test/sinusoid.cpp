@@ -0,0 +1,55 @@
+#include <cmath>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../sinusoid.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("sinusoid")
+{
+    SUBCASE("generateSine() fills caller-owned storage like generateSineBuffer()")
+    {
+        auto buffer = generateSineBuffer<float>(64);
+
+        vector<float> range(64);
+        generateSine(range.begin(), range.end());
+
+        for (auto i = 0; i < 64; ++i)
+            CHECK(range[i] == doctest::Approx(buffer[i]));
+    }
+
+    SUBCASE("makeSineTable() matches generateSineBuffer()")
+    {
+        constexpr auto table = makeSineTable<float, 64>();
+        static_assert(table.size() == 64, "table should be available at compile time");
+
+        auto buffer = generateSineBuffer<float>(64);
+        for (auto i = 0; i < 64; ++i)
+            CHECK(table[i] == doctest::Approx(buffer[i]));
+    }
+
+    SUBCASE("SinusoidGenerator")
+    {
+        const auto increment = TAU<double> / 100;
+        SinusoidGenerator<double> generator(increment);
+
+        SUBCASE("tracks sin() over long streams")
+        {
+            for (auto i = 0; i < 10000; ++i)
+                CHECK(generator() == doctest::Approx(sin(i * increment)).epsilon(0.0001));
+        }
+
+        SUBCASE("phase is continuous across blocks")
+        {
+            vector<double> block1(75), block2(75);
+            generator.generate(block1.begin(), block1.end());
+            generator.generate(block2.begin(), block2.end());
+
+            for (auto i = 0; i < 75; ++i)
+                CHECK(block2[i] == doctest::Approx(sin((75 + i) * increment)).epsilon(0.0001));
+        }
+    }
+}
@@ -0,0 +1,159 @@
+#include <cmath>
+#include <vector>
+
+#include "doctest.h"
+
+#include "../spline.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("CubicSpline")
+{
+    CubicSpline spline;
+    spline.emplace(0, 1);
+    spline.emplace(1, 8);
+    spline.emplace(2, -3);
+    spline.emplace(3, 5);
+
+    SUBCASE("operator[]")
+    {
+        SUBCASE("hits the control points")
+        {
+            CHECK(spline[0] == doctest::Approx(1));
+            CHECK(spline[1] == doctest::Approx(8));
+            CHECK(spline[2] == doctest::Approx(-3));
+            CHECK(spline[3] == doctest::Approx(5));
+        }
+
+        SUBCASE("clamps before the first point")
+        {
+            CHECK(spline[-1] == doctest::Approx(1));
+        }
+    }
+
+    SUBCASE("positions and values come out sorted")
+    {
+        CHECK(spline.size() == 4);
+
+        const vector<float> positions = {0, 1, 2, 3};
+        const vector<float> values = {1, 8, -3, 5};
+        CHECK(spline.positions() == positions);
+        CHECK(spline.values() == values);
+        CHECK(spline.coefficients().a.size() == 4);
+    }
+
+    SUBCASE("span() matches operator[]")
+    {
+        auto out = spline.span(0, 4);
+        for (auto i = 0; i < 4; ++i)
+            CHECK(out[i] == doctest::Approx(spline[i]));
+    }
+
+    SUBCASE("span() starting before the first point")
+    {
+        CubicSpline shifted;
+        shifted.emplace(2, 1);
+        shifted.emplace(4, 8);
+        shifted.emplace(6, -3);
+
+        auto out = shifted.span(0, 7);
+        for (auto i = 0; i < 7; ++i)
+            CHECK(out[i] == doctest::Approx(shifted[i]));
+    }
+
+    SUBCASE("deferred recomputation gives the same results")
+    {
+        CubicSpline deferred;
+        deferred.deferRecomputation();
+        deferred.emplace(0, 1);
+        deferred.emplace(1, 8);
+        deferred.emplace(2, -3);
+        deferred.emplace(3, 5);
+
+        CHECK(deferred[1.5] == doctest::Approx(spline[1.5]));
+    }
+
+    SUBCASE("setY() agrees with a full recompute")
+    {
+        CubicSpline rebuilt;
+        rebuilt.emplace(0, 1);
+        rebuilt.emplace(1, 4);
+        rebuilt.emplace(2, -3);
+        rebuilt.emplace(3, 5);
+
+        CHECK(spline.setY(1, 4));
+        for (double x = 0; x < 3; x += 0.25)
+            CHECK(spline[x] == doctest::Approx(rebuilt[x]));
+    }
+
+    SUBCASE("setY() with a small radius approximates the full solve")
+    {
+        CubicSpline local, rebuilt;
+        for (auto i = 0; i < 20; ++i)
+        {
+            local.emplace(i, (i * 7) % 5);
+            rebuilt.emplace(i, i == 10 ? 13 : (i * 7) % 5);
+        }
+
+        CHECK(local.setY(10, 13, 6));
+        for (double x = 0; x < 19; x += 0.5)
+            CHECK(local[x] == doctest::Approx(rebuilt[x]).epsilon(0.005));
+    }
+
+    SUBCASE("setY() returns false for an unknown x")
+    {
+        CHECK_FALSE(spline.setY(7, 0));
+    }
+
+    SUBCASE("StaticCubicSpline matches CubicSpline")
+    {
+        StaticCubicSpline<4> fixed({0, 1, 2, 3}, {1, 8, -3, 5});
+
+        for (double x = -1; x < 4; x += 0.25)
+            CHECK(fixed[x] == doctest::Approx(spline[x]));
+
+        SUBCASE("span() writes into caller-owned storage")
+        {
+            vector<float> out(4);
+            fixed.span(0, out.begin(), out.end());
+
+            for (auto i = 0; i < 4; ++i)
+                CHECK(out[i] == doctest::Approx(spline[i]));
+        }
+
+        SUBCASE("sorts the points on construction")
+        {
+            StaticCubicSpline<4> shuffled({3, 1, 0, 2}, {5, 8, 1, -3});
+            CHECK(shuffled[1.3] == doctest::Approx(fixed[1.3]));
+        }
+    }
+
+    SUBCASE("threaded envelope extraction matches the single-threaded version")
+    {
+        vector<float> signal(301);
+        for (auto i = 0; i < 300; ++i)
+            signal[i] = sin(i * 0.37) * cos(i * 0.05);
+        signal[300] = signal[299];
+
+        SUBCASE("minimaSpline()")
+        {
+            const auto serial = minimaSpline(signal);
+            const auto threaded = minimaSpline(signal, 3);
+
+            REQUIRE(threaded.size() == serial.size());
+            for (size_t i = 0; i < serial.size(); ++i)
+                CHECK(threaded[i] == doctest::Approx(serial[i]));
+        }
+
+        SUBCASE("maximaSpline()")
+        {
+            const auto single = maximaSpline(signal, 1);
+            const auto threaded = maximaSpline(signal, 3);
+
+            REQUIRE(threaded.size() == single.size());
+            for (size_t i = 0; i < single.size(); ++i)
+                CHECK(threaded[i] == doctest::Approx(single[i]));
+        }
+    }
+}
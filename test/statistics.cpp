@@ -0,0 +1,93 @@
+#include <vector>
+
+#include "doctest.h"
+
+#include "../linear.hpp"
+#include "../statistics.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("statistics")
+{
+    vector<float> x = {1, -4, 3, 2};
+
+    SUBCASE("summarize() agrees with the individual functions")
+    {
+        auto summary = summarize<float>(x.begin(), x.end());
+
+        CHECK(summary.mean == doctest::Approx(mean<float>(x.begin(), x.end())));
+        CHECK(summary.meanSquare == doctest::Approx(meanSquare<float>(x.begin(), x.end())));
+        CHECK(summary.rootMeanSquare == doctest::Approx(rootMeanSquare<float>(x.begin(), x.end())));
+        CHECK(summary.minimum == doctest::Approx(-4));
+        CHECK(summary.maximum == doctest::Approx(3));
+        CHECK(summary.peakPosition == 1);
+    }
+
+    SUBCASE("RunningMean matches mean() after push/pop")
+    {
+        RunningMean<float> running;
+        for (auto& value : x)
+            running.push(value);
+
+        CHECK(running.mean() == doctest::Approx(mean<float>(x.begin(), x.end())));
+
+        running.pop(x.front());
+        CHECK(running.mean() == doctest::Approx(mean<float>(std::next(x.begin()), x.end())));
+    }
+
+    SUBCASE("WindowedMeanSquare matches rootMeanSquare() over the last window")
+    {
+        WindowedMeanSquare<float> windowed(3);
+        for (auto& value : x)
+            windowed.push(value);
+
+        CHECK(windowed.size() == 3);
+        CHECK(windowed.rootMeanSquare() == doctest::Approx(rootMeanSquare<float>(std::next(x.begin()), x.end())));
+
+        CHECK_THROWS_AS(WindowedMeanSquare<float>(0), std::invalid_argument);
+    }
+
+    SUBCASE("accumulator policies")
+    {
+        // Single-precision summation drops the ones next to the large leading value
+        vector<float> drifting(1001, 1);
+        drifting.front() = 1e8f;
+
+        const auto exact = (1e8 + 1000.0) / 1001.0;
+
+        SUBCASE("mean() accumulating in double recovers the lost bits")
+        {
+            const auto naive = mean<float>(drifting.begin(), drifting.end());
+            const auto accurate = mean<float, double>(drifting.begin(), drifting.end());
+
+            CHECK(naive != doctest::Approx(exact).epsilon(1e-6));
+            CHECK(accurate == doctest::Approx(exact).epsilon(1e-6));
+        }
+
+        SUBCASE("a KahanAccumulator keeps single-precision sums from drifting")
+        {
+            const auto compensated = mean<float, KahanAccumulator<float>>(drifting.begin(), drifting.end());
+            CHECK(compensated == doctest::Approx(exact).epsilon(1e-6));
+        }
+
+        SUBCASE("meanSquare() accepts the same policies")
+        {
+            const auto reference = meanSquare<double>(drifting.begin(), drifting.end());
+            const auto accurate = meanSquare<float, double>(drifting.begin(), drifting.end());
+
+            CHECK(accurate == doctest::Approx(reference).epsilon(1e-6));
+        }
+
+        SUBCASE("dot() accumulating in double")
+        {
+            vector<float> ones(drifting.size(), 1);
+
+            const auto reference = dot<double>(drifting.data(), ones.data(), drifting.size());
+            const float compensated = dot<KahanAccumulator<float>>(drifting.begin(), ones.begin(), drifting.size());
+
+            CHECK(reference == doctest::Approx(1e8 + 1000.0).epsilon(1e-6));
+            CHECK(compensated == doctest::Approx(reference).epsilon(1e-6));
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#include <vector>
+
+#include "doctest.h"
+
+#include "../ease.hpp"
+#include "../sigmoid.hpp"
+#include "../table.hpp"
+
+using namespace math;
+using namespace std;
+
+TEST_CASE("LookupTable")
+{
+    LookupTable<float, 512> table([](double x){ return sigmoid(x, 2.0, 2.0); }, -1, 1);
+
+    SUBCASE("approximates the sampled function")
+    {
+        for (double x = -1; x <= 1; x += 0.173)
+            CHECK(table(x) == doctest::Approx(sigmoid(x, 2.0, 2.0)).epsilon(0.001));
+    }
+
+    SUBCASE("clamps outside of the interval")
+    {
+        CHECK(table(-2) == doctest::Approx(sigmoid(-1.0, 2.0, 2.0)));
+        CHECK(table(2) == doctest::Approx(sigmoid(1.0, 2.0, 2.0)));
+    }
+
+    SUBCASE("an argument rounding up to the last sample stays in bounds")
+    {
+        // (x - min) * factor rounds up to exactly N - 1 for this x, which used to read
+        // one sample past the table
+        const auto x = 1.0 - 0x1p-53;
+        CHECK(table(x) == doctest::Approx(sigmoid(1.0, 2.0, 2.0)));
+    }
+
+    SUBCASE("process() matches per-sample lookup")
+    {
+        const vector<double> in = {-0.8, -0.1, 0.3, 0.9};
+        vector<float> out(in.size());
+        table.process(in.begin(), in.end(), out.begin());
+
+        for (size_t i = 0; i < in.size(); ++i)
+            CHECK(out[i] == doctest::Approx(table(in[i])));
+    }
+
+    SUBCASE("works for easing functions")
+    {
+        LookupTable<float, 512> ease(&easeCosine<double>, 0, 1);
+        CHECK(ease(0.25) == doctest::Approx(easeCosine(0.25)).epsilon(0.001));
+    }
+
+    SUBCASE("constexpr construction")
+    {
+        constexpr LookupTable<float, 2> unit([](double x){ return x; }, 0, 1);
+        static_assert(unit.size() == 2, "size should be available at compile time");
+        CHECK(unit(0.5) == doctest::Approx(0.5));
+    }
+}
@@ -0,0 +1,53 @@
+#include <cstdint>
+
+#include "doctest.h"
+
+#include "../utility.hpp"
+
+using namespace math;
+
+TEST_CASE("utility")
+{
+    SUBCASE("clampFast() agrees with clamp()")
+    {
+        for (int value = -10; value < 10; ++value)
+            CHECK(clampFast(value, -3, 4) == clamp(value, -3, 4));
+
+        for (float value = -2; value < 2; value += 0.25f)
+            CHECK(clampFast(value, -0.5f, 0.5f) == clamp(value, -0.5f, 0.5f));
+    }
+
+    SUBCASE("wrapFast() agrees with wrap()")
+    {
+        SUBCASE("integral")
+        {
+            for (int value = -100; value < 100; ++value)
+            {
+                CHECK(wrapFast(value, -3, 4) == wrap(value, -3, 4));
+                CHECK(wrapFast(value, 7) == wrap(value, 7));
+            }
+        }
+
+        SUBCASE("floating-point")
+        {
+            for (float value = -20; value < 20; value += 0.375f)
+            {
+                CHECK(wrapFast(value, -1.f, 1.f) == doctest::Approx(wrap(value, -1.f, 1.f)));
+                CHECK(wrapFast(value, 2.5f) == doctest::Approx(wrap(value, 2.5f)));
+            }
+        }
+
+        SUBCASE("far outside the range")
+        {
+            CHECK(wrapFast(1000000, -3, 4) == wrap(1000000, -3, 4));
+            CHECK(wrapFast(-1000000, -3, 4) == wrap(-1000000, -3, 4));
+        }
+    }
+
+    SUBCASE("wrapPowerOf2() agrees with wrapFast() for power-of-two sizes")
+    {
+        for (int size : {1, 2, 8, 64})
+            for (int value = -100; value < 100; ++value)
+                CHECK(wrapPowerOf2(value, size) == wrapFast(value, size));
+    }
+}
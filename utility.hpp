@@ -81,6 +81,57 @@ namespace math
         return value;
     }
     
+    //! Clamp a number within a given range, without argument checking
+    /*! Variant of clamp() for hot-loop index math: noexcept and free of the invalid-argument
+        throw, so the comparisons can become conditional moves
+     @warning If max < min, the result is undefined */
+    template <typename T>
+    constexpr T clampFast(const T& value, const T& min, const T& max) noexcept
+    {
+        return value < min ? min : max < value ? max : value;
+    }
+
+    //! Wrap an integral number within a given range using modulo
+    /*! Constant-time variant of wrap(): indices far outside the range cost the same as nearby
+        ones, instead of one loop iteration per period
+     @warning If max <= min, the result is undefined */
+    template <typename T>
+    constexpr std::enable_if_t<std::is_integral<T>::value, T> wrapFast(const T& value, const T& min, const T& max) noexcept
+    {
+        const auto range = max - min;
+        return min + ((value - min) % range + range) % range;
+    }
+
+    //! Wrap a floating-point number within a given range using floor
+    /*! Constant-time variant of wrap(): values far outside the range cost the same as nearby
+        ones, instead of one loop iteration per period
+     @warning If max <= min, the result is undefined */
+    template <typename T>
+    std::enable_if_t<std::is_floating_point<T>::value, T> wrapFast(const T& value, const T& min, const T& max) noexcept
+    {
+        const auto range = max - min;
+        return value - std::floor((value - min) / range) * range;
+    }
+
+    //! Wrap a number within a given range using modulo, where min = 0
+    /*! @warning If max <= 0, the result is undefined */
+    template <typename T, typename U>
+    constexpr auto wrapFast(const T& value, const U& max) noexcept
+    {
+        return wrapFast<std::common_type_t<T, U>>(value, 0, max);
+    }
+
+    //! Wrap an integral number into [0, size) for a power-of-two size, using a bit mask
+    /*! Variant of wrapFast() for ring buffers and wavetables sized with ceilToPowerOf2():
+        a single and-operation instead of the two divisions the modulo takes. The mask also
+        handles negative values, since they sit just below the period in two's complement
+     @warning If size is not a power of two (see isPowerOf2()), the result is undefined */
+    template <typename T>
+    constexpr std::enable_if_t<std::is_integral<T>::value, T> wrapPowerOf2(const T& value, const T& size) noexcept
+    {
+        return value & (size - 1);
+    }
+
     //! Returns whether an integral is a power of two
     /*! @return false for x == 0 */
     constexpr bool isPowerOf2(size_t x)